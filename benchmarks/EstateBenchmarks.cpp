@@ -0,0 +1,804 @@
+#include "../include/core/Constants.h"
+#include "../include/core/Money.h"
+#include "../include/entities/Apartment.h"
+#include "../include/entities/Auction.h"
+#include "../include/entities/Bid.h"
+#include "../include/entities/Client.h"
+#include "../include/entities/CommercialProperty.h"
+#include "../include/entities/House.h"
+#include "../include/entities/Transaction.h"
+#include "../include/services/AuctionManager.h"
+#include "../include/services/AuctionScheduler.h"
+#include "../include/services/ClientMatcher.h"
+#include "../include/services/ClientManager.h"
+#include "../include/services/FileManager.h"
+#include "../include/services/PropertyManager.h"
+#include "../include/services/ProxyBidding.h"
+#include "../include/services/ReferentialIntegrity.h"
+#include "../include/services/ReportGenerator.h"
+#include "../include/services/TransactionManager.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef ESTATE_VERSION
+#define ESTATE_VERSION "unknown"
+#endif
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr uint64_t DEFAULT_SEED = 42;
+constexpr double DEFAULT_MIN_TIME_SECONDS = 0.2;
+constexpr size_t MAX_SAMPLES = 1000;
+constexpr size_t LOOKUPS_PER_SAMPLE = 64;
+constexpr size_t CHURN_PER_SAMPLE = 100;
+constexpr int FIRST_ID = 10000000;
+constexpr int FIRST_CHURN_ID = 90000000;
+constexpr size_t DEPENDENTS_PER_PROPERTY = 4;
+constexpr int64_t MIN_PRICE_RUBLES = 20000;
+constexpr int64_t MAX_PRICE_RUBLES = 500000000;
+constexpr int64_t AUCTION_START_RUBLES = 1000000;
+constexpr int64_t PRICE_STEP_PERCENT = 5;
+constexpr int64_t PROFILE_PRICE_SPREAD_PERCENT = 20;
+constexpr double NANOSECONDS_PER_SECOND = 1e9;
+constexpr double BYTES_PER_MEGABYTE = 1024.0 * 1024.0;
+
+constexpr std::array CITIES = {"Minsk", "Gomel", "Brest", "Grodno", "Vitebsk", "Mogilev", "Borisov", "Pinsk"};
+constexpr std::array STREETS = {"Lenina", "Pobediteley", "Nezavisimosti", "Sovetskaya", "Gagarina", "Mira"};
+constexpr std::array NAMES = {"Ivanov", "Petrov", "Sidorov", "Kozlov", "Novikov", "Morozov", "Volkov", "Sokolov"};
+constexpr std::array STATUSES = {Constants::TransactionStatus::PENDING, Constants::TransactionStatus::COMPLETED,
+                                 Constants::TransactionStatus::CANCELLED};
+
+struct Options
+{
+    std::vector<size_t> sizes = {1000, 10000, 100000};
+    std::string filter;
+    std::string outputFile;
+    std::filesystem::path workDirectory = std::filesystem::temp_directory_path() / "estate_benchmarks";
+    double minTimeSeconds = DEFAULT_MIN_TIME_SECONDS;
+    uint64_t seed = DEFAULT_SEED;
+};
+
+volatile size_t sink = 0;
+
+void consume(size_t value) { sink = sink + value; }
+
+struct Sample
+{
+    size_t items = 0;
+    size_t bytes = 0;
+};
+
+struct Result
+{
+    std::string name;
+    size_t size = 0;
+    size_t samples = 0;
+    double nsPerOp = 0.0;
+    double medianNsPerOp = 0.0;
+    double minNsPerOp = 0.0;
+    double itemsPerSecond = 0.0;
+    double megabytesPerSecond = 0.0;
+};
+
+struct Dataset
+{
+    PropertyManager properties;
+    ClientManager clients;
+    ClientMatcher matcher;
+    TransactionManager transactions;
+    AuctionManager auctions;
+    std::vector<std::string> propertyIds;
+    std::vector<std::string> clientIds;
+    std::vector<std::string> transactionIds;
+};
+
+class Runner
+{
+  private:
+    Options options;
+    std::vector<Result> results;
+
+  public:
+    explicit Runner(Options options) : options(std::move(options)) {}
+
+    bool enabled(std::string_view name) const { return options.filter.empty() || name.contains(options.filter); }
+
+    void run(const std::string &name, size_t size, const std::function<Sample()> &body)
+    {
+        if (!enabled(name))
+        {
+            return;
+        }
+
+        std::vector<double> perOp;
+        size_t totalItems = 0;
+        size_t totalBytes = 0;
+        double totalSeconds = 0.0;
+        while (perOp.size() < MAX_SAMPLES && (perOp.empty() || totalSeconds < options.minTimeSeconds))
+        {
+            auto start = Clock::now();
+            Sample sample = body();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            totalSeconds += seconds;
+            totalItems += sample.items;
+            totalBytes += sample.bytes;
+            perOp.push_back(seconds * NANOSECONDS_PER_SECOND / static_cast<double>(std::max<size_t>(1, sample.items)));
+        }
+
+        std::ranges::sort(perOp);
+        Result result;
+        result.name = name;
+        result.size = size;
+        result.samples = perOp.size();
+        result.nsPerOp = totalSeconds * NANOSECONDS_PER_SECOND / static_cast<double>(std::max<size_t>(1, totalItems));
+        result.medianNsPerOp = perOp[perOp.size() / 2];
+        result.minNsPerOp = perOp.front();
+        result.itemsPerSecond = totalSeconds > 0.0 ? static_cast<double>(totalItems) / totalSeconds : 0.0;
+        result.megabytesPerSecond =
+            totalSeconds > 0.0 ? static_cast<double>(totalBytes) / BYTES_PER_MEGABYTE / totalSeconds : 0.0;
+
+        std::cerr << std::format("{:<48} n={:<9} {:>14.1f} ns/op {:>14.0f} items/s", name, size, result.nsPerOp,
+                                 result.itemsPerSecond);
+        if (totalBytes > 0)
+        {
+            std::cerr << std::format(" {:>9.1f} MB/s", result.megabytesPerSecond);
+        }
+        std::cerr << "\n";
+        results.push_back(std::move(result));
+    }
+
+    void writeJson(std::ostream &out) const
+    {
+        out << "{\n"
+            << std::format("  \"version\": \"{}\",\n", ESTATE_VERSION)
+            << std::format("  \"seed\": {},\n", options.seed) << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &r = results[i];
+            out << std::format("    {{\"name\": \"{}\", \"size\": {}, \"samples\": {}, \"ns_per_op\": {:.2f}, "
+                               "\"median_ns_per_op\": {:.2f}, \"min_ns_per_op\": {:.2f}, \"items_per_second\": {:.1f}, "
+                               "\"mb_per_second\": {:.2f}}}{}\n",
+                               r.name, r.size, r.samples, r.nsPerOp, r.medianNsPerOp, r.minNsPerOp, r.itemsPerSecond,
+                               r.megabytesPerSecond, i + 1 < results.size() ? "," : "");
+        }
+        out << "  ]\n}\n";
+    }
+};
+
+std::vector<size_t> parseSizes(const std::string &text)
+{
+    std::vector<size_t> sizes;
+    std::istringstream iss(text);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        if (!token.empty())
+        {
+            sizes.push_back(std::stoull(token));
+        }
+    }
+    if (sizes.empty())
+    {
+        throw std::invalid_argument("No dataset sizes given");
+    }
+    return sizes;
+}
+
+Options parseOptions(int argc, char *argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            std::cout << "Usage: estate_benchmarks [--sizes 1000,10000,...] [--filter TEXT] [--output FILE]\n"
+                         "                         [--min-time SECONDS] [--work-dir DIR] [--seed S]\n";
+            std::exit(0);
+        }
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::format("Missing value for {}", arg));
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--sizes")
+            options.sizes = parseSizes(value);
+        else if (arg == "--filter")
+            options.filter = value;
+        else if (arg == "--output")
+            options.outputFile = value;
+        else if (arg == "--min-time")
+            options.minTimeSeconds = std::stod(value);
+        else if (arg == "--work-dir")
+            options.workDirectory = value;
+        else if (arg == "--seed")
+            options.seed = std::stoull(value);
+        else
+            throw std::invalid_argument(std::format("Unknown option: {}", arg));
+    }
+    return options;
+}
+
+PropertyBaseParams makeBase(const std::string &id, std::mt19937_64 &rng)
+{
+    std::uniform_int_distribution<int64_t> price(MIN_PRICE_RUBLES, MAX_PRICE_RUBLES);
+    std::uniform_int_distribution<size_t> city(0, CITIES.size() - 1);
+    std::uniform_int_distribution<size_t> street(0, STREETS.size() - 1);
+    std::uniform_int_distribution<int> house(1, 200);
+    std::uniform_real_distribution<double> area(20.0, 500.0);
+    return {id, CITIES[city(rng)], STREETS[street(rng)], std::to_string(house(rng)),
+            Money::fromRubles(price(rng)), area(rng), "Synthetic listing"};
+}
+
+std::unique_ptr<Property> makeProperty(const std::string &id, std::mt19937_64 &rng)
+{
+    switch (rng() % 3)
+    {
+    case 0:
+        return std::make_unique<Apartment>(ApartmentParams{makeBase(id, rng), 2, 5, true, true});
+    case 1:
+        return std::make_unique<House>(HouseParams{makeBase(id, rng), 2, 5, 600.0, true, false});
+    default:
+        return std::make_unique<CommercialProperty>(
+            CommercialPropertyParams{makeBase(id, rng), "Office", true, 10, true});
+    }
+}
+
+SearchProfile makeProfile(const std::string &clientId, std::mt19937_64 &rng)
+{
+    std::uniform_int_distribution<int64_t> price(MIN_PRICE_RUBLES, MAX_PRICE_RUBLES);
+    Money target = Money::fromRubles(price(rng));
+    SearchProfile profile;
+    profile.clientId = clientId;
+    profile.minPrice = target.scaled(100 - PROFILE_PRICE_SPREAD_PERCENT, 100);
+    profile.maxPrice = target.scaled(100 + PROFILE_PRICE_SPREAD_PERCENT, 100);
+    if (rng() % 4 != 0)
+    {
+        profile.city = StringPool::instance().intern(CITIES[rng() % CITIES.size()]);
+    }
+    if (rng() % 2 == 0)
+    {
+        profile.kind = static_cast<PropertyKind>(rng() % 3);
+    }
+    if (rng() % 4 == 0)
+    {
+        profile.minRooms = 2;
+    }
+    return profile;
+}
+
+std::shared_ptr<Client> makeClient(const std::string &id, size_t index, std::mt19937_64 &rng)
+{
+    std::string name = std::format("{} {}", NAMES[rng() % NAMES.size()], index);
+    return std::make_shared<Client>(id, name, std::format("+375{:09}", index % 1000000000),
+                                    std::format("client{}@example.com", index));
+}
+
+void buildDataset(Dataset &data, size_t size, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+
+    std::vector<PropertyPtr> properties;
+    std::vector<std::shared_ptr<Client>> clients;
+    std::vector<std::shared_ptr<Transaction>> transactions;
+    std::vector<std::shared_ptr<Auction>> auctions;
+    std::vector<SearchProfile> profiles;
+    properties.reserve(size);
+    clients.reserve(size);
+    transactions.reserve(size);
+    data.propertyIds.reserve(size);
+    data.clientIds.reserve(size);
+    data.transactionIds.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        std::string id = std::to_string(FIRST_ID + static_cast<int>(i));
+        properties.push_back(makeProperty(id, rng));
+        clients.push_back(makeClient(id, i, rng));
+        profiles.push_back(makeProfile(id, rng));
+        data.propertyIds.push_back(id);
+        data.clientIds.push_back(id);
+        data.transactionIds.push_back(id);
+    }
+
+    std::uniform_int_distribution<size_t> pick(0, size - 1);
+    for (size_t i = 0; i < size; ++i)
+    {
+        const Property *property = properties[pick(rng)].get();
+        transactions.push_back(std::make_shared<Transaction>(data.transactionIds[i], property->getId(),
+                                                             data.clientIds[pick(rng)], property->getPrice(),
+                                                             STATUSES[rng() % STATUSES.size()], ""));
+    }
+
+    size_t auctionCount = std::max<size_t>(1, size / 100);
+    for (size_t i = 0; i < auctionCount; ++i)
+    {
+        const Property *property = properties[i].get();
+        auto auction = std::make_shared<Auction>(property->getId(), property->getId(), property->getAddress(),
+                                                 property->getPrice());
+        for (int64_t b = 1; b <= 10; ++b)
+        {
+            auction->addBidDirect(std::make_shared<Bid>(data.clientIds[pick(rng)], "Bidder",
+                                                        property->getPrice() + Money::fromRubles(b * 100)));
+        }
+        auctions.push_back(std::move(auction));
+    }
+
+    data.properties.setProperties(std::move(properties));
+    data.clients.setClients(std::move(clients));
+    data.matcher.setProfiles(std::move(profiles));
+    data.transactions.setTransactions(std::move(transactions));
+    data.auctions.setAuctions(std::move(auctions));
+}
+
+template <typename Fn> Sample lookupBatch(const std::vector<std::string> &ids, std::mt19937_64 &rng, Fn &&lookup)
+{
+    std::uniform_int_distribution<size_t> pick(0, ids.size() - 1);
+    size_t found = 0;
+    for (size_t i = 0; i < LOOKUPS_PER_SAMPLE; ++i)
+    {
+        found += lookup(ids[pick(rng)]) ? 1 : 0;
+    }
+    if (found != LOOKUPS_PER_SAMPLE)
+    {
+        throw std::runtime_error("Lookup benchmark missed an existing ID");
+    }
+    return {LOOKUPS_PER_SAMPLE, 0};
+}
+
+void runQueries(Runner &runner, Dataset &data, size_t size, std::mt19937_64 &rng)
+{
+    runner.run("PropertyManager/findProperty", size, [&]()
+               { return lookupBatch(data.propertyIds, rng, [&](const std::string &id)
+                                    { return data.properties.findProperty(id) != nullptr; }); });
+    runner.run("ClientManager/findClient", size, [&]()
+               { return lookupBatch(data.clientIds, rng, [&](const std::string &id)
+                                    { return data.clients.findClient(id) != nullptr; }); });
+    runner.run("TransactionManager/findTransaction", size, [&]()
+               { return lookupBatch(data.transactionIds, rng, [&](const std::string &id)
+                                    { return data.transactions.findTransaction(id) != nullptr; }); });
+
+    runner.run("ClientManager/findDuplicates", size,
+               [&]()
+               {
+                   std::uniform_int_distribution<size_t> pick(0, size - 1);
+                   for (size_t i = 0; i < LOOKUPS_PER_SAMPLE; ++i)
+                   {
+                       consume(data.clients.findDuplicates(*data.clients.getClients()[pick(rng)]).size());
+                   }
+                   return Sample{LOOKUPS_PER_SAMPLE, 0};
+               });
+    runner.run("ClientManager/findAllDuplicates", size,
+               [&]()
+               {
+                   consume(data.clients.findAllDuplicates().size());
+                   return Sample{data.clients.getCount(), 0};
+               });
+
+    runner.run("ClientMatcher/match", size,
+               [&]()
+               {
+                   std::uniform_int_distribution<size_t> pick(0, size - 1);
+                   for (size_t i = 0; i < LOOKUPS_PER_SAMPLE; ++i)
+                   {
+                       consume(data.matcher.match(*data.properties.getProperties()[pick(rng)]).size());
+                   }
+                   return Sample{LOOKUPS_PER_SAMPLE, 0};
+               });
+
+    std::uniform_int_distribution<int64_t> price(MIN_PRICE_RUBLES, MAX_PRICE_RUBLES * 9 / 10);
+    runner.run("PropertyManager/searchByPriceRange", size,
+               [&]()
+               {
+                   Money low = Money::fromRubles(price(rng));
+                   auto found = data.properties.searchByPriceRange(low, low + Money::fromRubles(MAX_PRICE_RUBLES / 10));
+                   consume(found.size());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("PropertyManager/aggregate", size,
+               [&]()
+               {
+                   PropertyFilter filter;
+                   filter.minPrice = Money::fromRubles(price(rng));
+                   filter.minArea = 50.0;
+                   filter.available = true;
+                   consume(data.properties.aggregate(filter).count);
+                   const auto &columns = data.properties.getColumns();
+                   return Sample{columns.size(), columns.getMemoryBytes()};
+               });
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse42, SimdLevel::Avx2})
+    {
+        if (!FilterKernels::isSupported(level))
+        {
+            continue;
+        }
+        const FilterKernels &kernels = FilterKernels::forLevel(level);
+        runner.run(std::string("PropertyColumns/filter/") + FilterKernels::getLevelName(level), size,
+                   [&]()
+                   {
+                       PropertyFilter filter;
+                       filter.minPrice = Money::fromRubles(price(rng));
+                       filter.maxPrice = *filter.minPrice + Money::fromRubles(MAX_PRICE_RUBLES / 10);
+                       filter.minArea = 50.0;
+                       filter.available = true;
+                       filter.kind = PropertyKind::Apartment;
+                       const auto &columns = data.properties.getColumns();
+                       consume(columns.evaluate(filter, kernels).count());
+                       size_t rowBytes = sizeof(int64_t) + sizeof(double) + sizeof(uint8_t) + sizeof(PropertyKind);
+                       return Sample{columns.size(), columns.size() * rowBytes};
+                   });
+    }
+    runner.run("PropertyManager/query/indexed", size,
+               [&]()
+               {
+                   PropertyQuery query;
+                   Money low = Money::fromRubles(price(rng));
+                   query.between(PropertyField::Price, low, low + Money::fromRubles(MAX_PRICE_RUBLES / 1000))
+                       .where(PropertyField::Available, QueryOp::Equal, true)
+                       .orderBy(PropertyField::Price)
+                       .limit(20);
+                   consume(data.properties.query(query).count());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("PropertyManager/query/scan", size,
+               [&]()
+               {
+                   PropertyQuery query;
+                   query.where(PropertyField::Area, QueryOp::GreaterEqual, 50.0)
+                       .where(PropertyField::Kind, QueryOp::Equal, PropertyKind::House)
+                       .where(PropertyField::HasGarage, QueryOp::Equal, true)
+                       .orderBy(PropertyField::Price, true)
+                       .limit(20);
+                   consume(data.properties.query(query).count());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("PropertyManager/topK", size,
+               [&]()
+               {
+                   PropertyFilter filter;
+                   filter.kind = PropertyKind::Apartment;
+                   filter.city = StringPool::instance().intern(CITIES[rng() % CITIES.size()]);
+                   consume(data.properties.topK(filter, 10).size());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("PropertyManager/aggregateByCity", size,
+               [&]()
+               {
+                   consume(data.properties.aggregateByCity().size());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    consume(data.properties.getLiveStatsByCity().size());
+    runner.run("PropertyManager/liveStatsByCity", size,
+               [&]()
+               {
+                   consume(data.properties.getLiveStatsByCity().size());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("PropertyManager/searchByAddress", size,
+               [&]()
+               {
+                   auto found = data.properties.searchByAddress(CITIES[rng() % CITIES.size()], "len");
+                   consume(found.size());
+                   return Sample{data.properties.getCount(), 0};
+               });
+    runner.run("ClientManager/searchByName", size,
+               [&]()
+               {
+                   auto found = data.clients.searchByName(NAMES[rng() % NAMES.size()]);
+                   consume(found.size());
+                   return Sample{data.clients.getCount(), 0};
+               });
+
+    std::uniform_int_distribution<size_t> pick(0, size - 1);
+    runner.run("TransactionManager/getTransactionsByClient", size,
+               [&]()
+               {
+                   auto found = data.transactions.getTransactionsByClient(data.clientIds[pick(rng)]);
+                   consume(found.size());
+                   return Sample{data.transactions.getCount(), 0};
+               });
+    runner.run("AuctionManager/aggregateClearingByKind", size,
+               [&]()
+               {
+                   consume(data.auctions.aggregateClearingByKind(data.properties).size());
+                   return Sample{data.auctions.getCount(), 0};
+               });
+    runner.run("TransactionManager/aggregateByMonth", size,
+               [&]()
+               {
+                   consume(data.transactions.aggregateByMonth().size());
+                   return Sample{data.transactions.getCount(), 0};
+               });
+    consume(data.transactions.getMostRecent(1).size());
+    runner.run("TransactionManager/getMostRecent", size,
+               [&]()
+               {
+                   consume(data.transactions.getMostRecent(50).size());
+                   return Sample{50, 0};
+               });
+    runner.run("TransactionManager/getTransactionsByProperty", size,
+               [&]()
+               {
+                   auto found = data.transactions.getTransactionsByProperty(data.propertyIds[pick(rng)]);
+                   consume(found.size());
+                   return Sample{data.transactions.getCount(), 0};
+               });
+    runner.run("TransactionManager/getTransactionsByStatus", size,
+               [&]()
+               {
+                   auto found = data.transactions.getTransactionsByStatus(STATUSES[rng() % STATUSES.size()]);
+                   consume(found.size());
+                   return Sample{data.transactions.getCount(), 0};
+               });
+}
+
+void runChurn(Runner &runner, Dataset &data, size_t size, std::mt19937_64 &rng)
+{
+    runner.run("PropertyManager/addRemove", size,
+               [&]()
+               {
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.properties.addProperty(
+                           makeProperty(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)), rng));
+                   }
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.properties.removeProperty(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)));
+                   }
+                   return Sample{CHURN_PER_SAMPLE * 2, 0};
+               });
+    runner.run("ClientMatcher/addRemove", size,
+               [&]()
+               {
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.matcher.addProfile(makeProfile(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)), rng));
+                   }
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.matcher.removeProfilesByClient(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)));
+                   }
+                   consume(data.matcher.match(*data.properties.getProperties()[rng() % size]).size());
+                   return Sample{CHURN_PER_SAMPLE * 2, 0};
+               });
+    runner.run("ClientManager/addRemove", size,
+               [&]()
+               {
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.clients.addClient(makeClient(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)), i, rng));
+                   }
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       data.clients.removeClient(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)));
+                   }
+                   return Sample{CHURN_PER_SAMPLE * 2, 0};
+               });
+    std::uniform_int_distribution<size_t> pick(0, size - 1);
+    std::uniform_int_distribution<int64_t> percent(-PRICE_STEP_PERCENT, PRICE_STEP_PERCENT);
+    runner.run("PropertyManager/setPrice", size,
+               [&]()
+               {
+                   size_t before = data.properties.getPriceHistory().getEncodedBytes();
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       const Property *property = data.properties.getProperties()[pick(rng)].get();
+                       Money price = property->getPrice().scaled(100 + percent(rng), 100);
+                       data.properties.setPrice(property, std::clamp(price, Money::fromRubles(MIN_PRICE_RUBLES),
+                                                                     Money::fromRubles(MAX_PRICE_RUBLES)));
+                   }
+                   return Sample{CHURN_PER_SAMPLE, data.properties.getPriceHistory().getEncodedBytes() - before};
+               });
+    runner.run("PriceHistory/getChanges", size,
+               [&]()
+               {
+                   auto changes = data.properties.getPriceHistory().getChanges(0, std::time(nullptr));
+                   consume(changes.size());
+                   return Sample{data.properties.getPriceHistory().getPointCount(), 0};
+               });
+
+    AuctionScheduler scheduler(data.auctions, data.transactions, data.properties);
+    ProxyBidding proxyBidding(data.auctions);
+    ReferentialIntegrity integrity(data.properties, data.clients, data.transactions, data.auctions, data.matcher,
+                                   scheduler, proxyBidding);
+    runner.run("ReferentialIntegrity/cascadeProperty", size,
+               [&]()
+               {
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       std::string propertyId = std::to_string(FIRST_CHURN_ID + static_cast<int>(i));
+                       data.properties.addProperty(makeProperty(propertyId, rng));
+                       for (size_t j = 0; j < DEPENDENTS_PER_PROPERTY; ++j)
+                       {
+                           size_t offset = CHURN_PER_SAMPLE + i * DEPENDENTS_PER_PROPERTY + j;
+                           std::string id = std::to_string(FIRST_CHURN_ID + static_cast<int>(offset));
+                           data.transactions.addTransaction(
+                               std::make_shared<Transaction>(id, propertyId, data.clientIds[pick(rng)],
+                                                             Money::fromRubles(MIN_PRICE_RUBLES),
+                                                             Constants::TransactionStatus::PENDING, ""));
+                       }
+                   }
+                   for (size_t i = 0; i < CHURN_PER_SAMPLE; ++i)
+                   {
+                       integrity.removeProperty(std::to_string(FIRST_CHURN_ID + static_cast<int>(i)),
+                                                DeletePolicy::Cascade);
+                   }
+                   return Sample{CHURN_PER_SAMPLE * (DEPENDENTS_PER_PROPERTY + 1), 0};
+               });
+}
+
+size_t fileSize(const std::filesystem::path &path)
+{
+    return static_cast<size_t>(std::filesystem::file_size(path));
+}
+
+void runFiles(Runner &runner, const Dataset &data, size_t size, const std::filesystem::path &dir)
+{
+    std::filesystem::create_directories(dir);
+    auto propertiesFile = (dir / "properties.txt").string();
+    auto clientsFile = (dir / "clients.txt").string();
+    auto transactionsFile = (dir / "transactions.txt").string();
+    auto auctionsFile = (dir / "auctions.txt").string();
+    auto priceHistoryFile = (dir / "price_history.txt").string();
+
+    runner.run("FileManager/saveProperties", size,
+               [&]()
+               {
+                   FileManager::saveProperties(data.properties, propertiesFile);
+                   return Sample{data.properties.getCount(), fileSize(propertiesFile)};
+               });
+    runner.run("FileManager/loadProperties", size,
+               [&]()
+               {
+                   PropertyManager loaded;
+                   FileManager::loadProperties(loaded, propertiesFile);
+                   return Sample{loaded.getCount(), fileSize(propertiesFile)};
+               });
+    runner.run("FileManager/saveClients", size,
+               [&]()
+               {
+                   FileManager::saveClients(data.clients, clientsFile);
+                   return Sample{data.clients.getCount(), fileSize(clientsFile)};
+               });
+    runner.run("FileManager/loadClients", size,
+               [&]()
+               {
+                   ClientManager loaded;
+                   FileManager::loadClients(loaded, clientsFile);
+                   return Sample{loaded.getCount(), fileSize(clientsFile)};
+               });
+    runner.run("FileManager/saveTransactions", size,
+               [&]()
+               {
+                   FileManager::saveTransactions(data.transactions, transactionsFile);
+                   return Sample{data.transactions.getCount(), fileSize(transactionsFile)};
+               });
+    runner.run("FileManager/loadTransactions", size,
+               [&]()
+               {
+                   TransactionManager loaded;
+                   FileManager::loadTransactions(loaded, transactionsFile);
+                   return Sample{loaded.getCount(), fileSize(transactionsFile)};
+               });
+    runner.run("FileManager/saveAuctions", size,
+               [&]()
+               {
+                   FileManager::saveAuctions(data.auctions, auctionsFile);
+                   return Sample{data.auctions.getCount(), fileSize(auctionsFile)};
+               });
+    runner.run("FileManager/loadAuctions", size,
+               [&]()
+               {
+                   AuctionManager loaded;
+                   FileManager::loadAuctions(loaded, auctionsFile);
+                   return Sample{loaded.getCount(), fileSize(auctionsFile)};
+               });
+    runner.run("FileManager/savePriceHistory", size,
+               [&]()
+               {
+                   FileManager::savePriceHistory(data.properties, priceHistoryFile);
+                   return Sample{data.properties.getPriceHistory().getPointCount(), fileSize(priceHistoryFile)};
+               });
+    runner.run("FileManager/loadPriceHistory", size,
+               [&]()
+               {
+                   PropertyManager loaded;
+                   FileManager::loadPriceHistory(loaded, priceHistoryFile);
+                   return Sample{loaded.getPriceHistory().getPointCount(), fileSize(priceHistoryFile)};
+               });
+
+    ReportGenerator reports(data.properties, data.clients, data.transactions, data.auctions);
+    auto salesFile = (dir / "sales.csv").string();
+    auto periodFile = (dir / "sales_by_month.html").string();
+    runner.run("ReportGenerator/writeSales", size,
+               [&]()
+               {
+                   auto summary = reports.writeSales(salesFile, ReportFormat::Csv);
+                   return Sample{summary.rows, summary.bytes};
+               });
+    runner.run("ReportGenerator/writeSalesByPeriod", size,
+               [&]()
+               {
+                   reports.writeSalesByPeriod(periodFile, ReportFormat::Html, ReportPeriod::Month);
+                   return Sample{data.transactions.getCount(), 0};
+               });
+}
+
+void runAuction(Runner &runner, size_t size)
+{
+    runner.run("Auction/addBid", size,
+               [&]()
+               {
+                   Money start = Money::fromRubles(AUCTION_START_RUBLES);
+                   Auction auction("100000", "100000", "Benchmark lot", start);
+                   for (size_t i = 1; i <= size; ++i)
+                   {
+                       auction.addBid(std::make_shared<Bid>("100000", "Bidder",
+                                                            start + Money::fromKopecks(static_cast<int64_t>(i))));
+                   }
+                   return Sample{size, 0};
+               });
+}
+} 
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        Options options = parseOptions(argc, argv);
+        Runner runner(options);
+
+        for (size_t size : options.sizes)
+        {
+            std::mt19937_64 rng(options.seed);
+            Dataset data;
+            buildDataset(data, size, options.seed);
+
+            runQueries(runner, data, size, rng);
+            runChurn(runner, data, size, rng);
+            runFiles(runner, data, size, options.workDirectory);
+            runAuction(runner, size);
+        }
+        std::filesystem::remove_all(options.workDirectory);
+
+        if (options.outputFile.empty())
+        {
+            runner.writeJson(std::cout);
+        }
+        else
+        {
+            std::ofstream out(options.outputFile);
+            if (!out.is_open())
+            {
+                throw std::runtime_error("Cannot open output file: " + options.outputFile);
+            }
+            runner.writeJson(out);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "estate_benchmarks: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+#ifndef AGGREGATION_H
+#define AGGREGATION_H
+
+#include "Money.h"
+#include "QuantileSketch.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct AggregateStats
+{
+    size_t count = 0;
+    size_t valueCount = 0;
+    Money total;
+    Money minValue;
+    Money maxValue;
+    QuantileSketch sketch;
+
+    void add(Money value);
+    void addWithoutValue() { ++count; }
+    void merge(const AggregateStats &other);
+
+    Money getAverage() const;
+    Money getPercentile(double q) const;
+    Money getMedian() const { return getPercentile(0.5); }
+    double getValueRatio() const
+    {
+        return count > 0 ? static_cast<double>(valueCount) / static_cast<double>(count) : 0.0;
+    }
+    size_t getMemoryBytes() const { return sizeof(AggregateStats) + sketch.getMemoryBytes(); }
+};
+
+template <typename Key> using GroupedAggregate = std::map<Key, AggregateStats>;
+
+template <typename Key> void mergeGroups(GroupedAggregate<Key> &target, const GroupedAggregate<Key> &source)
+{
+    for (const auto &[key, stats] : source)
+    {
+        target[key].merge(stats);
+    }
+}
+
+template <typename Key, typename KeyOf, typename AddRow>
+GroupedAggregate<Key> groupRows(size_t rows, KeyOf &&keyOf, AddRow &&addRow)
+{
+    auto scan = [&keyOf, &addRow](size_t begin, size_t end, GroupedAggregate<Key> &groups)
+    {
+        for (size_t row = begin; row < end; ++row)
+        {
+            if (std::optional<Key> key = keyOf(row))
+            {
+                addRow(groups[*key], row);
+            }
+        }
+    };
+
+    GroupedAggregate<Key> result;
+    ThreadPool &pool = ThreadPool::instance();
+    if (pool.getChunkCount(rows) < 2)
+    {
+        scan(0, rows, result);
+        return result;
+    }
+
+    std::vector<GroupedAggregate<Key>> partial(pool.getChunkCount(rows));
+    pool.parallelChunks(rows, [&](size_t chunk, size_t begin, size_t end) { scan(begin, end, partial[chunk]); });
+    for (const auto &groups : partial)
+    {
+        mergeGroups(result, groups);
+    }
+    return result;
+}
+
+template <typename Key, typename Convert>
+auto rekeyGroups(GroupedAggregate<Key> &&groups, Convert &&convert)
+{
+    GroupedAggregate<std::decay_t<decltype(convert(std::declval<const Key &>()))>> result;
+    for (auto &[key, stats] : groups)
+    {
+        result[convert(key)].merge(stats);
+    }
+    return result;
+}
+
+template <typename Key> class LiveAggregate
+{
+  private:
+    GroupedAggregate<Key> groups;
+    std::set<Key> staleKeys;
+    bool built = false;
+
+  public:
+    bool isBuilt() const { return built; }
+
+    void reset(GroupedAggregate<Key> &&fresh)
+    {
+        groups = std::move(fresh);
+        staleKeys.clear();
+        built = true;
+    }
+
+    void invalidate()
+    {
+        groups.clear();
+        staleKeys.clear();
+        built = false;
+    }
+
+    void add(const Key &key, Money value)
+    {
+        if (built)
+        {
+            groups[key].add(value);
+        }
+    }
+
+    void remove(const Key &key, Money value)
+    {
+        if (!built)
+        {
+            return;
+        }
+        auto it = groups.find(key);
+        if (it == groups.end())
+        {
+            return;
+        }
+        if (--it->second.count == 0)
+        {
+            groups.erase(it);
+            staleKeys.erase(key);
+            return;
+        }
+        --it->second.valueCount;
+        it->second.total -= value;
+        staleKeys.insert(key);
+    }
+
+    template <typename Rebuild> const GroupedAggregate<Key> &get(Rebuild &&rebuild)
+    {
+        for (const Key &key : staleKeys)
+        {
+            groups[key] = rebuild(key);
+        }
+        staleKeys.clear();
+        return groups;
+    }
+
+    size_t getStaleCount() const { return staleKeys.size(); }
+
+    size_t getMemoryBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto &[key, stats] : groups)
+        {
+            bytes += sizeof(key) + stats.getMemoryBytes();
+        }
+        return bytes;
+    }
+};
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include <cstddef>
+
+struct AllocationStats
+{
+    size_t liveBytes = 0;
+    size_t liveAllocations = 0;
+    size_t totalAllocations = 0;
+    size_t peakBytes = 0;
+};
+
+class AllocationTracker
+{
+  public:
+    static bool isEnabled();
+    static AllocationStats getStats();
+};
+
+#endif
@@ -58,6 +58,7 @@ constexpr const char *TRANSACTION_UPDATED = "Сделка обновлена";
 constexpr const char *TRANSACTION_DELETED = "Сделка удалена";
 constexpr const char *AUCTION_CREATED = "Аукцион создан";
 constexpr const char *AUCTION_DELETED = "Аукцион удален";
+constexpr const char *AUCTIONS_EXPIRED = "Аукционы завершены по истечении срока";
 } 
 
 namespace SelectionMessages
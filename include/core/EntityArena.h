@@ -0,0 +1,135 @@
+#ifndef ENTITY_ARENA_H
+#define ENTITY_ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+template <typename T> size_t arenaObjectSize(const T &object)
+{
+    if constexpr (requires { object.getObjectSize(); })
+    {
+        return object.getObjectSize();
+    }
+    else
+    {
+        return sizeof(T);
+    }
+}
+
+struct ArenaDeleter
+{
+    static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+    std::pmr::memory_resource *resource = nullptr;
+
+    ArenaDeleter() = default;
+    explicit ArenaDeleter(std::pmr::memory_resource *resource) : resource(resource) {}
+    template <typename T> ArenaDeleter(std::default_delete<T>) {}
+
+    template <typename T> void operator()(T *object) const
+    {
+        if (resource == nullptr)
+        {
+            delete object;
+            return;
+        }
+        size_t size = arenaObjectSize(*object);
+        std::destroy_at(object);
+        resource->deallocate(object, size, ALIGNMENT);
+    }
+};
+
+template <typename T> using ArenaPtr = std::unique_ptr<T, ArenaDeleter>;
+
+class EntityArena;
+
+template <typename T> struct ArenaAllocator
+{
+    using value_type = T;
+
+    std::shared_ptr<EntityArena> arena;
+
+    explicit ArenaAllocator(std::shared_ptr<EntityArena> arena) : arena(std::move(arena)) {}
+    template <typename U> ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t count);
+    void deallocate(T *pointer, size_t count);
+
+    template <typename U> bool operator==(const ArenaAllocator<U> &other) const { return arena == other.arena; }
+};
+
+class EntityArena : public std::pmr::memory_resource, public std::enable_shared_from_this<EntityArena>
+{
+  private:
+    struct Slab
+    {
+        std::byte *data;
+        size_t size;
+    };
+
+    std::vector<Slab> slabs;
+    std::byte *cursor = nullptr;
+    std::byte *limit = nullptr;
+    std::mutex slabMutex;
+    std::atomic<size_t> reservedBytes{0};
+    std::atomic<size_t> usedBytes{0};
+
+    std::byte *allocateSlab(size_t size);
+
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+  public:
+    static constexpr size_t SLAB_BYTES = 1024 * 1024;
+    static constexpr size_t LARGE_BLOCK_BYTES = SLAB_BYTES / 4;
+
+    EntityArena() = default;
+    ~EntityArena() override;
+
+    EntityArena(const EntityArena &) = delete;
+    EntityArena &operator=(const EntityArena &) = delete;
+
+    std::pmr::memory_resource *getResource() { return this; }
+    size_t getReservedBytes() const { return reservedBytes.load(std::memory_order_relaxed); }
+    size_t getUsedBytes() const { return usedBytes.load(std::memory_order_relaxed); }
+
+    template <typename T, typename... Args> ArenaPtr<T> makeUnique(Args &&...args)
+    {
+        void *memory = allocate(sizeof(T), ArenaDeleter::ALIGNMENT);
+        try
+        {
+            T *object = std::uninitialized_construct_using_allocator(
+                static_cast<T *>(memory), std::pmr::polymorphic_allocator<>(this), std::forward<Args>(args)...);
+            return ArenaPtr<T>(object, ArenaDeleter(this));
+        }
+        catch (...)
+        {
+            deallocate(memory, sizeof(T), ArenaDeleter::ALIGNMENT);
+            throw;
+        }
+    }
+
+    template <typename T, typename... Args> std::shared_ptr<T> makeShared(Args &&...args)
+    {
+        return std::allocate_shared<T>(ArenaAllocator<T>(shared_from_this()), std::forward<Args>(args)...,
+                                       std::pmr::polymorphic_allocator<>(this));
+    }
+};
+
+template <typename T> T *ArenaAllocator<T>::allocate(size_t count)
+{
+    return static_cast<T *>(arena->getResource()->allocate(count * sizeof(T), alignof(T)));
+}
+
+template <typename T> void ArenaAllocator<T>::deallocate(T *pointer, size_t count)
+{
+    arena->getResource()->deallocate(pointer, count * sizeof(T), alignof(T));
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef ENTITY_CURSOR_H
+#define ENTITY_CURSOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using IdRows = std::unordered_map<std::string, uint32_t>;
+
+struct EntityPointer
+{
+    template <typename Ptr> auto operator()(const Ptr &ptr) const { return ptr.get(); }
+};
+
+template <typename Ptr>
+using EntityView = std::ranges::transform_view<std::ranges::ref_view<const std::vector<Ptr>>, EntityPointer>;
+
+template <typename Ptr> using EntitySpanView = std::ranges::transform_view<std::span<const Ptr>, EntityPointer>;
+
+template <typename Ptr> EntityView<Ptr> makeEntityView(const std::vector<Ptr> &items)
+{
+    return EntityView<Ptr>(std::ranges::ref_view(items), EntityPointer{});
+}
+
+struct PageCursor
+{
+    static constexpr size_t NO_POSITION = static_cast<size_t>(-1);
+
+    std::string afterId;
+    size_t position = NO_POSITION;
+
+    PageCursor() = default;
+    PageCursor(std::string_view afterId, size_t position = NO_POSITION) : afterId(afterId), position(position) {}
+
+    bool isStart() const { return afterId.empty() && position == NO_POSITION; }
+};
+
+template <typename Ptr> struct EntityPage
+{
+    EntitySpanView<Ptr> items;
+    PageCursor next;
+    bool hasMore = false;
+
+    auto begin() const { return items.begin(); }
+    auto end() const { return items.end(); }
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+};
+
+template <typename Ptr> size_t resolveCursor(const std::vector<Ptr> &items, const PageCursor &cursor)
+{
+    if (cursor.isStart())
+    {
+        return 0;
+    }
+    if (cursor.position != PageCursor::NO_POSITION && cursor.position > 0 && cursor.position <= items.size() &&
+        (!items[cursor.position - 1] || items[cursor.position - 1]->getId() == cursor.afterId))
+    {
+        return cursor.position;
+    }
+    if (auto it = std::ranges::find_if(items, [&cursor](const Ptr &item)
+                                       { return item && item->getId() == cursor.afterId; });
+        it != items.end())
+    {
+        return static_cast<size_t>(it - items.begin()) + 1;
+    }
+    if (cursor.position == PageCursor::NO_POSITION)
+    {
+        return items.size();
+    }
+    return std::min(cursor.position > 0 ? cursor.position - 1 : 0, items.size());
+}
+
+template <typename Ptr> EntityPage<Ptr> makePage(const std::vector<Ptr> &items, const PageCursor &after, size_t limit)
+{
+    size_t first = resolveCursor(items, after);
+    size_t last = first + std::min(limit, items.size() - first);
+    std::span<const Ptr> slice(items.data() + first, last - first);
+
+    EntityPage<Ptr> page{EntitySpanView<Ptr>(slice, EntityPointer{}), after, last < items.size()};
+    if (last > first)
+    {
+        page.next = PageCursor(items[last - 1] ? items[last - 1]->getId() : std::string(), last);
+    }
+    return page;
+}
+
+#endif
@@ -1,21 +1,56 @@
 #ifndef ESTATE_AGENCY_H
 #define ESTATE_AGENCY_H
 
+#include "../core/AllocationTracker.h"
+#include "../core/MemoryUsage.h"
+#include "../core/StringPool.h"
 #include "../services/AuctionManager.h"
+#include "../services/AuctionScheduler.h"
+#include "../services/ClientMatcher.h"
 #include "../services/ClientManager.h"
 #include "../services/PropertyManager.h"
+#include "../services/ProxyBidding.h"
+#include "../services/ReferentialIntegrity.h"
+#include "../services/ReportGenerator.h"
 #include "../services/TransactionManager.h"
 #include <string>
 #include <string_view>
 
+struct MemoryReport
+{
+    MemoryUsage properties;
+    MemoryUsage clients;
+    MemoryUsage transactions;
+    MemoryUsage auctions;
+    MemoryUsage symbols;
+    bool heapTracked = false;
+    AllocationStats heap;
+
+    MemoryUsage getTotal() const
+    {
+        MemoryUsage total = properties;
+        total += clients;
+        total += transactions;
+        total += auctions;
+        total += symbols;
+        return total;
+    }
+};
+
 class EstateAgency
 {
   private:
     static EstateAgency *instance;
     PropertyManager propertyManager;
     ClientManager clientManager;
+    ClientMatcher clientMatcher;
     TransactionManager transactionManager;
     AuctionManager auctionManager;
+    AuctionScheduler auctionScheduler{auctionManager, transactionManager, propertyManager};
+    ProxyBidding proxyBidding{auctionManager};
+    ReferentialIntegrity referentialIntegrity{propertyManager, clientManager, transactionManager, auctionManager,
+                                              clientMatcher, auctionScheduler, proxyBidding};
+    ReportGenerator reportGenerator{propertyManager, clientManager, transactionManager, auctionManager};
     std::string dataDirectory = "data";
 
     EstateAgency();
@@ -28,11 +63,18 @@ class EstateAgency
 
     PropertyManager &getPropertyManager() { return propertyManager; }
     ClientManager &getClientManager() { return clientManager; }
+    ClientMatcher &getClientMatcher() { return clientMatcher; }
     TransactionManager &getTransactionManager() { return transactionManager; }
     AuctionManager &getAuctionManager() { return auctionManager; }
+    AuctionScheduler &getAuctionScheduler() { return auctionScheduler; }
+    ProxyBidding &getProxyBidding() { return proxyBidding; }
+    ReferentialIntegrity &getReferentialIntegrity() { return referentialIntegrity; }
+    const ReportGenerator &getReportGenerator() const { return reportGenerator; }
 
     void saveAllData() const;
     void loadAllData();
+    void publishMetrics() const;
+    MemoryReport getMemoryReport() const;
 
     void setDataDirectory(std::string_view dir) { dataDirectory = std::string(dir); }
     std::string getDataDirectory() const { return dataDirectory; }
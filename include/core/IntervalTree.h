@@ -0,0 +1,131 @@
+#ifndef INTERVAL_TREE_H
+#define INTERVAL_TREE_H
+
+#include "MemoryUsage.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+template <typename Value> class IntervalTree
+{
+  public:
+    struct Interval
+    {
+        int64_t low = 0;
+        int64_t high = 0;
+        Value value{};
+    };
+
+  private:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    struct Node
+    {
+        int64_t center = 0;
+        uint32_t left = NO_NODE;
+        uint32_t right = NO_NODE;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Interval> byLow;
+    std::vector<Interval> byHigh;
+    uint32_t root = NO_NODE;
+
+    uint32_t build(std::span<Interval> intervals, std::vector<int64_t> &endpoints)
+    {
+        if (intervals.empty())
+        {
+            return NO_NODE;
+        }
+
+        endpoints.clear();
+        for (const Interval &interval : intervals)
+        {
+            endpoints.push_back(interval.low);
+            endpoints.push_back(interval.high);
+        }
+        auto middle = endpoints.begin() + static_cast<std::ptrdiff_t>(endpoints.size() / 2);
+        std::ranges::nth_element(endpoints, middle);
+        int64_t center = *middle;
+
+        auto leftEnd =
+            std::partition(intervals.begin(), intervals.end(), [center](const Interval &i) { return i.high < center; });
+        auto overlapEnd =
+            std::partition(leftEnd, intervals.end(), [center](const Interval &i) { return i.low <= center; });
+
+        auto index = static_cast<uint32_t>(nodes.size());
+        auto begin = static_cast<uint32_t>(byLow.size());
+        nodes.push_back({center, NO_NODE, NO_NODE, begin, begin});
+        byLow.insert(byLow.end(), leftEnd, overlapEnd);
+        byHigh.insert(byHigh.end(), leftEnd, overlapEnd);
+        std::ranges::sort(byLow.begin() + begin, byLow.end(), {}, &Interval::low);
+        std::ranges::sort(byHigh.begin() + begin, byHigh.end(), std::greater<>(), &Interval::high);
+        nodes[index].end = static_cast<uint32_t>(byLow.size());
+
+        uint32_t left = build({intervals.begin(), leftEnd}, endpoints);
+        uint32_t right = build({overlapEnd, intervals.end()}, endpoints);
+        nodes[index].left = left;
+        nodes[index].right = right;
+        return index;
+    }
+
+  public:
+    IntervalTree() = default;
+
+    explicit IntervalTree(std::vector<Interval> intervals)
+    {
+        byLow.reserve(intervals.size());
+        byHigh.reserve(intervals.size());
+        std::vector<int64_t> endpoints;
+        endpoints.reserve(intervals.size() * 2);
+        root = build(intervals, endpoints);
+    }
+
+    template <typename Visitor> void stab(int64_t point, Visitor &&visitor) const
+    {
+        for (uint32_t index = root; index != NO_NODE;)
+        {
+            const Node &node = nodes[index];
+            if (point < node.center)
+            {
+                for (uint32_t i = node.begin; i < node.end && byLow[i].low <= point; ++i)
+                {
+                    visitor(byLow[i].value);
+                }
+                index = node.left;
+            }
+            else if (point > node.center)
+            {
+                for (uint32_t i = node.begin; i < node.end && byHigh[i].high >= point; ++i)
+                {
+                    visitor(byHigh[i].value);
+                }
+                index = node.right;
+            }
+            else
+            {
+                for (uint32_t i = node.begin; i < node.end; ++i)
+                {
+                    visitor(byLow[i].value);
+                }
+                break;
+            }
+        }
+    }
+
+    size_t size() const { return byLow.size(); }
+    bool empty() const { return byLow.empty(); }
+
+    size_t getMemoryBytes() const
+    {
+        return Memory::vectorHeapBytes(nodes) + Memory::vectorHeapBytes(byLow) + Memory::vectorHeapBytes(byHigh);
+    }
+};
+
+#endif
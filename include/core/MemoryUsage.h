@@ -0,0 +1,65 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct MemoryUsage
+{
+    size_t objectCount = 0;
+    size_t objectBytes = 0;
+    size_t stringBytes = 0;
+    size_t indexBytes = 0;
+    size_t bidCount = 0;
+    size_t bidBytes = 0;
+    size_t arenaBytes = 0;
+
+    size_t getTotalBytes() const { return objectBytes + stringBytes + indexBytes + bidBytes; }
+
+    MemoryUsage &operator+=(const MemoryUsage &other)
+    {
+        objectCount += other.objectCount;
+        objectBytes += other.objectBytes;
+        stringBytes += other.stringBytes;
+        indexBytes += other.indexBytes;
+        bidCount += other.bidCount;
+        bidBytes += other.bidBytes;
+        arenaBytes += other.arenaBytes;
+        return *this;
+    }
+};
+
+namespace Memory
+{
+constexpr size_t SHARED_CONTROL_BLOCK_BYTES = 2 * sizeof(void *);
+constexpr size_t HASH_NODE_OVERHEAD = 2 * sizeof(void *);
+
+template <typename Allocator> bool isHeapString(const std::basic_string<char, std::char_traits<char>, Allocator> &value)
+{
+    const auto *data = reinterpret_cast<const std::byte *>(value.data());
+    const auto *object = reinterpret_cast<const std::byte *>(&value);
+    return data < object || data >= object + sizeof(value);
+}
+
+template <typename Allocator>
+size_t stringHeapBytes(const std::basic_string<char, std::char_traits<char>, Allocator> &value)
+{
+    return isHeapString(value) ? value.capacity() + 1 : 0;
+}
+
+template <typename T> size_t vectorHeapBytes(const std::vector<T> &values) { return values.capacity() * sizeof(T); }
+
+template <typename T> size_t stringMapHeapBytes(const std::unordered_map<std::string, T> &values)
+{
+    size_t bytes = values.bucket_count() * sizeof(void *);
+    for (const auto &[key, value] : values)
+    {
+        bytes += HASH_NODE_OVERHEAD + sizeof(key) + sizeof(value) + stringHeapBytes(key);
+    }
+    return bytes;
+}
+} 
+
+#endif
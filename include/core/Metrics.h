@@ -0,0 +1,136 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class alignas(64) Counter
+{
+  private:
+    std::atomic<uint64_t> value{0};
+
+  public:
+    void increment(uint64_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+    void reset() { value.store(0, std::memory_order_relaxed); }
+};
+
+class alignas(64) Gauge
+{
+  private:
+    std::atomic<int64_t> value{0};
+
+  public:
+    void set(int64_t newValue) { value.store(newValue, std::memory_order_relaxed); }
+    void add(int64_t amount) { value.fetch_add(amount, std::memory_order_relaxed); }
+    int64_t get() const { return value.load(std::memory_order_relaxed); }
+};
+
+class Histogram
+{
+  public:
+    static constexpr unsigned SUB_BUCKET_BITS = 5;
+    static constexpr size_t SUB_BUCKET_COUNT = size_t{1} << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+
+  public:
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketLowerBound(size_t index);
+    static uint64_t bucketUpperBound(size_t index);
+
+    void record(uint64_t value);
+    void reset();
+
+    uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t getSum() const { return sum.load(std::memory_order_relaxed); }
+    uint64_t getMax() const { return max.load(std::memory_order_relaxed); }
+    uint64_t percentile(double quantile) const;
+};
+
+enum class MetricType
+{
+    Counter,
+    Gauge,
+    Histogram
+};
+
+struct MetricSnapshot
+{
+    std::string name;
+    MetricType type = MetricType::Counter;
+    int64_t value = 0;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t p50 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+};
+
+class MetricsRegistry
+{
+  private:
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters;
+    std::map<std::string, std::unique_ptr<Gauge>, std::less<>> gauges;
+    std::map<std::string, std::unique_ptr<Histogram>, std::less<>> histograms;
+    std::string dumpPath;
+
+    MetricsRegistry() = default;
+
+  public:
+    static constexpr const char *ENVIRONMENT_VARIABLE = "ESTATE_METRICS_FILE";
+
+    static MetricsRegistry &instance();
+    static int64_t nowNs();
+
+    MetricsRegistry(const MetricsRegistry &) = delete;
+    MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+    Counter &counter(const std::string &name);
+    Gauge &gauge(const std::string &name);
+    Histogram &histogram(const std::string &name);
+
+    std::vector<MetricSnapshot> snapshot() const;
+    std::string formatText() const;
+    void dumpToFile(const std::string &filename) const;
+    void reset();
+
+    void configureFromEnvironment();
+    void setDumpPath(const std::string &path);
+    std::string getDumpPath() const;
+};
+
+class ScopedTimer
+{
+  private:
+    Histogram &histogram;
+    int64_t startNs;
+
+  public:
+    explicit ScopedTimer(Histogram &target);
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+};
+
+#define METRICS_CONCAT_INNER(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_INNER(a, b)
+#define METRIC_TIME_SCOPE(name)                                                                                        \
+    static Histogram &METRICS_CONCAT(metricHistogram, __LINE__) = MetricsRegistry::instance().histogram(name);         \
+    ScopedTimer METRICS_CONCAT(metricTimer, __LINE__)(METRICS_CONCAT(metricHistogram, __LINE__))
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+class Money
+{
+  private:
+    int64_t kopecks = 0;
+
+    constexpr explicit Money(int64_t value) : kopecks(value) {}
+
+  public:
+    static constexpr int64_t KOPECKS_PER_RUBLE = 100;
+    static constexpr size_t MAX_TEXT_LENGTH = 24;
+
+    constexpr Money() = default;
+
+    static constexpr Money fromKopecks(int64_t value) { return Money(value); }
+    static constexpr Money fromRubles(int64_t rubles) { return Money(rubles * KOPECKS_PER_RUBLE); }
+    static Money fromDouble(double rubles);
+    static std::optional<Money> parse(std::string_view text);
+
+    constexpr int64_t getKopecks() const { return kopecks; }
+    constexpr double toDouble() const { return static_cast<double>(kopecks) / KOPECKS_PER_RUBLE; }
+    constexpr bool isPositive() const { return kopecks > 0; }
+    constexpr bool isZero() const { return kopecks == 0; }
+
+    constexpr Money scaled(int64_t numerator, int64_t denominator) const
+    {
+        int64_t product = kopecks * numerator;
+        int64_t half = denominator / 2;
+        return Money(product >= 0 ? (product + half) / denominator : (product - half) / denominator);
+    }
+
+    std::string toString() const;
+    char *formatTo(char *out) const;
+
+    constexpr Money operator+(Money other) const { return Money(kopecks + other.kopecks); }
+    constexpr Money operator-(Money other) const { return Money(kopecks - other.kopecks); }
+    constexpr Money &operator+=(Money other)
+    {
+        kopecks += other.kopecks;
+        return *this;
+    }
+    constexpr Money &operator-=(Money other)
+    {
+        kopecks -= other.kopecks;
+        return *this;
+    }
+
+    constexpr bool operator==(const Money &other) const = default;
+    constexpr std::strong_ordering operator<=>(const Money &other) const = default;
+
+    friend std::ostream &operator<<(std::ostream &os, const Money &money) { return os << money.toString(); }
+};
+
+#endif
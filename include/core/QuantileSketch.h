@@ -0,0 +1,45 @@
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <cstddef>
+#include <vector>
+
+class QuantileSketch
+{
+  public:
+    static constexpr double DEFAULT_COMPRESSION = 100.0;
+
+  private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    double compression;
+    std::vector<Centroid> centroids;
+    std::vector<Centroid> buffer;
+    double totalWeight = 0.0;
+    double minValue = 0.0;
+    double maxValue = 0.0;
+
+    static std::vector<Centroid> compress(std::vector<Centroid> input, double compression);
+    void flush();
+
+  public:
+    explicit QuantileSketch(double compression = DEFAULT_COMPRESSION);
+
+    void add(double value, double weight = 1.0);
+    void merge(const QuantileSketch &other);
+    void clear();
+
+    double quantile(double q) const;
+    double getCount() const { return totalWeight; }
+    bool empty() const { return totalWeight == 0.0; }
+    double getMin() const { return minValue; }
+    double getMax() const { return maxValue; }
+    size_t getCentroidCount() const { return centroids.size() + buffer.size(); }
+    size_t getMemoryBytes() const;
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef REVERSE_INDEX_H
+#define REVERSE_INDEX_H
+
+#include "MemoryUsage.h"
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+template <typename Entity> class ReverseIndex
+{
+  private:
+    std::unordered_map<std::string, std::vector<Entity *>> dependents;
+
+  public:
+    void add(const std::string &key, Entity *entity)
+    {
+        if (!key.empty())
+        {
+            dependents[key].push_back(entity);
+        }
+    }
+
+    void remove(const std::string &key, Entity *entity)
+    {
+        auto it = dependents.find(key);
+        if (it == dependents.end())
+        {
+            return;
+        }
+        std::erase(it->second, entity);
+        if (it->second.empty())
+        {
+            dependents.erase(it);
+        }
+    }
+
+    std::vector<Entity *> extract(const std::string &key)
+    {
+        auto node = dependents.extract(key);
+        return node.empty() ? std::vector<Entity *>() : std::move(node.mapped());
+    }
+
+    std::span<Entity *const> find(std::string_view key) const
+    {
+        auto it = dependents.find(std::string(key));
+        return it != dependents.end() ? std::span<Entity *const>(it->second) : std::span<Entity *const>();
+    }
+
+    void clear() { dependents.clear(); }
+    void reserve(size_t count) { dependents.reserve(count); }
+    size_t getKeyCount() const { return dependents.size(); }
+
+    size_t getMemoryBytes() const
+    {
+        size_t bytes = Memory::stringMapHeapBytes(dependents);
+        for (const auto &[key, entities] : dependents)
+        {
+            bytes += Memory::vectorHeapBytes(entities);
+        }
+        return bytes;
+    }
+};
+
+#endif
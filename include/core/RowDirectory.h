@@ -0,0 +1,96 @@
+#ifndef ROW_DIRECTORY_H
+#define ROW_DIRECTORY_H
+
+#include "MemoryUsage.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class RowDirectory
+{
+  private:
+    std::unordered_map<std::string, uint64_t> sequenceById;
+    std::vector<uint64_t> sequences;
+    uint64_t nextSequence = 0;
+    size_t removedCount = 0;
+
+  public:
+    static constexpr size_t MIN_PENDING_REMOVALS = 1024;
+    static constexpr size_t PENDING_FRACTION = 16;
+    static constexpr size_t NO_ROW = static_cast<size_t>(-1);
+
+    void append(const std::string &id)
+    {
+        sequenceById.emplace(id, nextSequence);
+        sequences.push_back(nextSequence++);
+    }
+
+    size_t find(const std::string &id) const
+    {
+        auto it = sequenceById.find(id);
+        if (it == sequenceById.end())
+        {
+            return NO_ROW;
+        }
+        return static_cast<size_t>(std::ranges::lower_bound(sequences, it->second) - sequences.begin());
+    }
+
+    template <typename Ptr> void remove(std::vector<Ptr> &items, size_t row)
+    {
+        sequenceById.erase(items[row]->getId());
+        items[row].reset();
+        ++removedCount;
+    }
+
+    template <typename Ptr> bool compactIfNeeded(std::vector<Ptr> &items)
+    {
+        if (removedCount <= std::max(MIN_PENDING_REMOVALS, items.size() / PENDING_FRACTION))
+        {
+            return false;
+        }
+        size_t kept = 0;
+        for (size_t row = 0; row < items.size(); ++row)
+        {
+            if (!items[row])
+            {
+                continue;
+            }
+            if (kept != row)
+            {
+                items[kept] = std::move(items[row]);
+                sequences[kept] = sequences[row];
+            }
+            ++kept;
+        }
+        items.resize(kept);
+        sequences.resize(kept);
+        removedCount = 0;
+        return true;
+    }
+
+    template <typename Ptr> void rebuild(const std::vector<Ptr> &items)
+    {
+        sequenceById.clear();
+        sequences.clear();
+        nextSequence = 0;
+        removedCount = 0;
+        sequenceById.reserve(items.size());
+        sequences.reserve(items.size());
+        for (const auto &item : items)
+        {
+            append(item->getId());
+        }
+    }
+
+    size_t getRemovedCount() const { return removedCount; }
+
+    size_t getMemoryBytes() const
+    {
+        return Memory::stringMapHeapBytes(sequenceById) + Memory::vectorHeapBytes(sequences);
+    }
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include "../core/MemoryUsage.h"
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+enum class Symbol : uint32_t
+{
+};
+
+class StringPool
+{
+  private:
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, Symbol> symbols;
+
+    StringPool();
+
+  public:
+    static StringPool &instance();
+
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    Symbol intern(std::string_view value);
+    std::optional<Symbol> find(std::string_view value) const;
+    std::string_view resolve(Symbol symbol) const;
+    size_t size() const;
+    MemoryUsage getMemoryUsage() const;
+};
+
+class SymbolMatcher
+{
+  private:
+    std::string needle;
+    std::vector<int8_t> verdicts;
+
+  public:
+    explicit SymbolMatcher(std::string_view pattern);
+
+    bool isActive() const { return !needle.empty(); }
+    bool matches(Symbol symbol);
+};
+
+#endif
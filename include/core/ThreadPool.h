@@ -0,0 +1,87 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+  public:
+    static constexpr const char *ENVIRONMENT_VARIABLE = "ESTATE_THREADS";
+    static constexpr size_t PARALLEL_THRESHOLD = 32768;
+    static constexpr size_t MIN_CHUNK_ROWS = 8192;
+    static constexpr size_t CHUNKS_PER_WORKER = 4;
+
+  private:
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+    std::atomic<size_t> queuedTasks{0};
+    std::atomic<size_t> nextQueue{0};
+    bool stopping = false;
+
+    explicit ThreadPool(size_t workerCount);
+
+    void submit(std::function<void()> task);
+    bool runPending(size_t preferredQueue);
+    void workerLoop(size_t index);
+
+  public:
+    static ThreadPool &instance();
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    size_t getWorkerCount() const { return workers.size(); }
+    size_t getChunkCount(size_t rows) const;
+
+    void parallelFor(size_t taskCount, const std::function<void(size_t)> &task);
+    void parallelChunks(size_t rows, const std::function<void(size_t, size_t, size_t)> &scan);
+
+    template <typename T, typename ChunkScan> std::vector<T> collect(size_t rows, ChunkScan &&scan);
+};
+
+template <typename T, typename ChunkScan> std::vector<T> ThreadPool::collect(size_t rows, ChunkScan &&scan)
+{
+    std::vector<T> result;
+    size_t chunks = getChunkCount(rows);
+    if (chunks < 2)
+    {
+        scan(size_t{0}, rows, result);
+        return result;
+    }
+
+    std::vector<std::vector<T>> partial(chunks);
+    parallelChunks(rows, [&](size_t chunk, size_t begin, size_t end) { scan(begin, end, partial[chunk]); });
+
+    size_t total = 0;
+    for (const auto &part : partial)
+    {
+        total += part.size();
+    }
+    result.reserve(total);
+    for (auto &part : partial)
+    {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+class TimerWheel
+{
+  public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void(TimerId)>;
+
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 8;
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+
+  private:
+    struct Timer
+    {
+        int64_t expiry;
+        uint32_t version;
+        Callback callback;
+    };
+
+    struct SlotEntry
+    {
+        TimerId id;
+        uint32_t version;
+    };
+
+    using Slot = std::vector<SlotEntry>;
+
+    std::array<std::array<Slot, SLOTS>, LEVELS> wheel;
+    std::vector<SlotEntry> overdue;
+    std::unordered_map<TimerId, Timer> timers;
+    int64_t currentTick;
+    TimerId nextId = 1;
+
+    void place(TimerId id, const Timer &timer);
+    void cascade(int level);
+    size_t fireSlot(Slot &slot);
+    bool isLive(const SlotEntry &entry) const;
+
+  public:
+    explicit TimerWheel(int64_t startTick = 0);
+
+    TimerId schedule(int64_t expiryTick, Callback callback);
+    bool reschedule(TimerId id, int64_t expiryTick);
+    bool cancel(TimerId id);
+
+    size_t advance(int64_t nowTick);
+
+    int64_t getCurrentTick() const { return currentTick; }
+    int64_t getExpiry(TimerId id) const;
+    size_t size() const { return timers.size(); }
+    bool empty() const { return timers.empty(); }
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+template <typename T, typename Less = std::less<>> class BoundedHeap
+{
+  private:
+    size_t capacity;
+    Less less;
+    std::vector<T> heap;
+
+  public:
+    explicit BoundedHeap(size_t capacity, Less less = {}) : capacity(capacity), less(std::move(less))
+    {
+        heap.reserve(capacity);
+    }
+
+    bool wouldAccept(const T &value) const { return heap.size() < capacity || less(value, heap.front()); }
+
+    void push(T value)
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+        if (heap.size() < capacity)
+        {
+            heap.push_back(std::move(value));
+            std::ranges::push_heap(heap, less);
+        }
+        else if (less(value, heap.front()))
+        {
+            std::ranges::pop_heap(heap, less);
+            heap.back() = std::move(value);
+            std::ranges::push_heap(heap, less);
+        }
+    }
+
+    size_t size() const { return heap.size(); }
+    bool full() const { return heap.size() == capacity; }
+
+    std::vector<T> takeSorted()
+    {
+        std::ranges::sort_heap(heap, less);
+        return std::move(heap);
+    }
+};
+
+struct AcceptAll
+{
+    template <typename T> bool operator()(const T &) const { return true; }
+};
+
+template <typename Ptr, typename Less, typename Predicate = AcceptAll>
+auto selectTopK(const std::vector<Ptr> &items, size_t k, Less less, Predicate predicate = {})
+{
+    using Item = decltype(std::declval<const Ptr &>().get());
+    using Candidate = std::pair<size_t, Item>;
+    auto order = [&less](const Candidate &left, const Candidate &right)
+    {
+        if (less(*left.second, *right.second))
+        {
+            return true;
+        }
+        return !less(*right.second, *left.second) && left.first < right.first;
+    };
+
+    auto candidates = ThreadPool::instance().collect<Candidate>(
+        items.size(),
+        [&](size_t begin, size_t end, std::vector<Candidate> &result)
+        {
+            BoundedHeap<Candidate, decltype(order)> heap(std::min(k, end - begin), order);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (items[i] && predicate(*items[i]))
+                {
+                    heap.push({i, items[i].get()});
+                }
+            }
+            result = heap.takeSorted();
+        });
+
+    BoundedHeap<Candidate, decltype(order)> heap(std::min(k, candidates.size()), order);
+    for (auto &candidate : candidates)
+    {
+        heap.push(candidate);
+    }
+
+    std::vector<Item> result;
+    result.reserve(heap.size());
+    for (const auto &candidate : heap.takeSorted())
+    {
+        result.push_back(candidate.second);
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+struct TraceEvent
+{
+    const char *name = nullptr;
+    int64_t startNs = 0;
+    int64_t durationNs = 0;
+};
+
+class Tracer
+{
+  private:
+    static std::atomic<bool> enabled;
+
+  public:
+    static constexpr size_t RING_CAPACITY = 65536;
+    static constexpr const char *ENVIRONMENT_VARIABLE = "ESTATE_TRACE";
+
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+    static void configureFromEnvironment();
+
+    static int64_t nowNs();
+    static void record(const char *name, int64_t startNs, int64_t endNs);
+    static void clear();
+
+    static size_t getEventCount();
+    static size_t exportChromeTrace(const std::string &filename);
+};
+
+class TraceSpan
+{
+  private:
+    const char *name;
+    int64_t startNs;
+
+  public:
+    explicit TraceSpan(const char *name) : name(Tracer::isEnabled() ? name : nullptr), startNs(0)
+    {
+        if (this->name)
+        {
+            startNs = Tracer::nowNs();
+        }
+    }
+
+    ~TraceSpan()
+    {
+        if (name)
+        {
+            Tracer::record(name, startNs, Tracer::nowNs());
+        }
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+
+#endif
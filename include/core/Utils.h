@@ -1,10 +1,11 @@
 #ifndef UTILS_H
 #define UTILS_H
 
-#include <QString>
+#include "Money.h"
 #include <chrono>
 #include <ctime>
 #include <iomanip>
+#include <optional>
 #include <ranges>
 #include <sstream>
 #include <string>
@@ -41,26 +42,27 @@ inline std::string getCurrentTimeString(const char *format = "%Y-%m-%d %H:%M:%S"
     return oss.str();
 }
 
-inline std::string toString(const QString &qstr) { return qstr.toStdString(); }
-
-inline QString toQString(const std::string &str) { return QString::fromStdString(str); }
-
-inline std::string safeToString(const QString &qstr) { return qstr.isEmpty() ? std::string() : qstr.toStdString(); }
-
-inline QString formatPrice(double price) { return QString::number(price, 'f', 2) + " руб."; }
-
-inline QString formatNumber(double number, int decimals = 2) { return QString::number(number, 'f', decimals); }
+inline std::string formatTime(std::time_t time, const char *format = "%Y-%m-%d %H:%M:%S")
+{
+    auto tm = getLocalTime(time);
+    std::ostringstream oss;
+    oss << std::put_time(&tm, format);
+    return oss.str();
+}
 
-inline bool isNumericId(const QString &str)
+inline std::optional<std::time_t> parseTime(const std::string &text, const char *format = "%Y-%m-%d %H:%M:%S")
 {
-    if (str.length() < 6 || str.length() > 8)
+    std::tm tm{};
+    std::istringstream iss(text);
+    iss >> std::get_time(&tm, format);
+    if (iss.fail())
     {
-        return false;
+        return std::nullopt;
     }
-    return std::ranges::all_of(str, [](const QChar &ch) { return ch.isDigit(); });
+    tm.tm_isdst = -1;
+    return std::mktime(&tm);
 }
 
-
 inline bool stringContains(std::string_view str, std::string_view substr) { return str.contains(substr); }
 } 
 
@@ -13,12 +13,13 @@ class Apartment : public Property
     bool hasElevator;
 
   public:
-    explicit Apartment(const ApartmentParams &params);
+    explicit Apartment(const ApartmentParams &params, const allocator_type &allocator = {});
 
     std::string getType() const override;
     void displayInfo() const override;
     std::string toFileString() const override;
     Property *clone() const override;
+    size_t getObjectSize() const override { return sizeof(*this); }
 
     int getRooms() const { return rooms; }
     int getFloor() const { return floor; }
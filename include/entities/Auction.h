@@ -1,30 +1,39 @@
 #ifndef AUCTION_H
 #define AUCTION_H
 
+#include "../core/Money.h"
 #include "Bid.h"
 #include <compare>
+#include <ctime>
 #include <format>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
 class Auction
 {
   private:
-    std::string id;
-    std::string propertyId;
-    std::string propertyAddress;
-    double startingPrice;
-    double buyoutPrice;
+    std::pmr::string id;
+    std::pmr::string propertyId;
+    std::pmr::string propertyAddress;
+    Money startingPrice;
+    Money buyoutPrice;
     std::vector<std::shared_ptr<Bid>> bids;
-    std::string status = "active";
-    std::string createdAt;
-    std::string completedAt;
+    const Bid *highestBid = nullptr;
+    std::pmr::string status;
+    std::pmr::string createdAt;
+    std::pmr::string completedAt;
+    std::time_t endTime = 0;
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    static constexpr Money MIN_BID_INCREMENT = Money::fromKopecks(1);
+
     Auction(const std::string &id, const std::string &propertyId, const std::string &propertyAddress,
-            double startingPrice);
+            Money startingPrice, const allocator_type &allocator = {});
 
     bool operator==(const Auction &other) const;
     std::strong_ordering operator<=>(const Auction &other) const;
@@ -32,25 +41,37 @@ class Auction
     bool addBid(std::shared_ptr<Bid> bid);
     void addBidDirect(std::shared_ptr<Bid> bid);
 
-    double getCurrentHighestBid() const;
+    Money getCurrentHighestBid() const;
+    Money getMinimumNextBid() const;
     const Bid *getHighestBid() const;
 
     void complete();
     void cancel();
+    void detachProperty();
 
-    std::string getId() const { return id; }
-    std::string getPropertyId() const { return propertyId; }
-    std::string getPropertyAddress() const { return propertyAddress; }
-    double getStartingPrice() const { return startingPrice; }
-    double getBuyoutPrice() const { return buyoutPrice; }
+    std::string getId() const { return std::string(id); }
+    std::string getPropertyId() const { return std::string(propertyId); }
+    std::string getPropertyAddress() const { return std::string(propertyAddress); }
+    Money getStartingPrice() const { return startingPrice; }
+    Money getBuyoutPrice() const { return buyoutPrice; }
     std::vector<std::shared_ptr<Bid>> getBids() const { return bids; }
-    std::string getStatus() const { return status; }
-    std::string getCreatedAt() const { return createdAt; }
-    std::string getCompletedAt() const { return completedAt; }
+    size_t getBidCount() const { return bids.size(); }
+    std::string getStatus() const { return std::string(status); }
+    std::string getCreatedAt() const { return std::string(createdAt); }
+    std::string getCompletedAt() const { return std::string(completedAt); }
+    size_t getStringBytes() const;
+    size_t getBidBytes() const;
     bool isActive() const { return status == "active"; }
     bool isCompleted() const { return status == "completed"; }
 
+    std::time_t getEndTime() const { return endTime; }
+    bool hasDeadline() const { return endTime > 0; }
+    std::string getEndTimeString() const;
+    void setEndTime(std::time_t time);
+    void setTimestamps(const std::string &createdAt, const std::string &completedAt);
+
     bool wasBuyout() const;
+    static Money calculateBuyoutPrice(Money startingPrice);
     std::string toString() const;
     std::string toFileString() const;
 
@@ -58,8 +79,8 @@ class Auction
     {
         os << std::format("Auction ID: {}\n", auction.id)
            << std::format("Property: {} (ID: {})\n", auction.propertyAddress, auction.propertyId)
-           << std::format("Starting Price: {:.2f} руб.\n", auction.startingPrice)
-           << std::format("Buyout Price: {:.2f} руб.\n", auction.buyoutPrice)
+           << std::format("Starting Price: {} руб.\n", auction.startingPrice.toString())
+           << std::format("Buyout Price: {} руб.\n", auction.buyoutPrice.toString())
            << std::format("Status: {}\n", auction.status) << std::format("Bids Count: {}\n", auction.bids.size())
            << std::format("Created: {}", auction.createdAt);
         return os;
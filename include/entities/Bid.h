@@ -1,31 +1,36 @@
 #ifndef BID_H
 #define BID_H
 
+#include "../core/Money.h"
 #include <compare>
 #include <format>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 
 class Bid
 {
   private:
-    std::string clientId;
-    std::string clientName;
-    double amount;
-    std::string timestamp;
+    std::pmr::string clientId;
+    std::pmr::string clientName;
+    Money amount;
+    std::pmr::string timestamp;
 
   public:
-    Bid(const std::string &clientId, const std::string &clientName, double amount);
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Bid(const std::string &clientId, const std::string &clientName, Money amount, const allocator_type &allocator = {});
 
     friend std::ostream &operator<<(std::ostream &os, const Bid &bid);
 
     bool operator==(const Bid &other) const;
-    std::partial_ordering operator<=>(const Bid &other) const;
+    std::strong_ordering operator<=>(const Bid &other) const;
 
-    std::string getClientId() const { return clientId; }
-    std::string getClientName() const { return clientName; }
-    double getAmount() const { return amount; }
-    std::string getTimestamp() const { return timestamp; }
+    std::string getClientId() const { return std::string(clientId); }
+    std::string getClientName() const { return std::string(clientName); }
+    Money getAmount() const { return amount; }
+    std::string getTimestamp() const { return std::string(timestamp); }
+    size_t getStringBytes() const;
 
     std::string toString() const;
     std::string toFileString() const;
@@ -33,7 +38,7 @@ class Bid
     friend std::ostream &operator<<(std::ostream &os, const Bid &bid)
     {
         os << std::format("Client: {} (ID: {})\n", bid.clientName, bid.clientId)
-           << std::format("Amount: {:.2f} руб.\n", bid.amount) << std::format("Time: {}", bid.timestamp);
+           << std::format("Amount: {} руб.\n", bid.amount.toString()) << std::format("Time: {}", bid.timestamp);
         return os;
     }
 };
@@ -3,35 +3,41 @@
 
 #include <compare>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
 class Client
 {
   private:
-    std::string id;
-    std::string name;
-    std::string phone;
-    std::string email;
-    std::string registrationDate;
+    std::pmr::string id;
+    std::pmr::string name;
+    std::pmr::string phone;
+    std::pmr::string email;
+    std::pmr::string registrationDate;
 
   public:
-    Client(const std::string &id, const std::string &name, const std::string &phone, const std::string &email);
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Client(const std::string &id, const std::string &name, const std::string &phone, const std::string &email,
+           const allocator_type &allocator = {});
 
     friend std::ostream &operator<<(std::ostream &os, const Client &client);
 
     bool operator==(const Client &other) const;
     std::strong_ordering operator<=>(const Client &other) const;
 
-    std::string getId() const { return id; }
-    std::string getName() const { return name; }
-    std::string getPhone() const { return phone; }
-    std::string getEmail() const { return email; }
-    std::string getRegistrationDate() const { return registrationDate; }
+    std::string getId() const { return std::string(id); }
+    std::string getName() const { return std::string(name); }
+    std::string getPhone() const { return std::string(phone); }
+    std::string getEmail() const { return std::string(email); }
+    std::string getRegistrationDate() const { return std::string(registrationDate); }
+    size_t getStringBytes() const;
 
     void setName(std::string_view name);
     void setPhone(std::string_view phone);
     void setEmail(std::string_view email);
+    void setRegistrationDate(const std::string &date);
 
     static bool validateId(std::string_view id);
     static bool validatePhone(std::string_view phone);
@@ -8,20 +8,22 @@
 class CommercialProperty : public Property
 {
   private:
-    std::string businessType;
+    Symbol businessType;
     bool hasParking;
     int parkingSpaces;
     bool isVisibleFromStreet;
 
   public:
-    explicit CommercialProperty(const CommercialPropertyParams &params);
+    explicit CommercialProperty(const CommercialPropertyParams &params, const allocator_type &allocator = {});
 
     std::string getType() const override;
     void displayInfo() const override;
     std::string toFileString() const override;
     Property *clone() const override;
+    size_t getObjectSize() const override { return sizeof(*this); }
 
-    std::string getBusinessType() const { return businessType; }
+    std::string getBusinessType() const { return std::string(StringPool::instance().resolve(businessType)); }
+    Symbol getBusinessTypeSymbol() const { return businessType; }
     bool getHasParking() const { return hasParking; }
     int getParkingSpaces() const { return parkingSpaces; }
     bool getIsVisibleFromStreet() const { return isVisibleFromStreet; }
@@ -14,12 +14,13 @@ class House : public Property
     bool hasGarden;
 
   public:
-    explicit House(const HouseParams &params);
+    explicit House(const HouseParams &params, const allocator_type &allocator = {});
 
     std::string getType() const override;
     void displayInfo() const override;
     std::string toFileString() const override;
     Property *clone() const override;
+    size_t getObjectSize() const override { return sizeof(*this); }
 
     int getFloors() const { return floors; }
     int getRooms() const { return rooms; }
@@ -1,54 +1,63 @@
 #ifndef PROPERTY_H
 #define PROPERTY_H
 
+#include "../core/Money.h"
+#include "../core/StringPool.h"
 #include <compare>
 #include <format>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
 class Property
 {
   private:
-    std::string id;
-    std::string city;
-    std::string street;
-    std::string house;
-    double price;
+    std::pmr::string id;
+    Symbol city;
+    Symbol street;
+    std::pmr::string house;
+    Money price;
     double area;
-    std::string description;
+    std::pmr::string description;
     bool isAvailable = true;
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     Property(const std::string &id, const std::string &city, const std::string &street, const std::string &house,
-             double price, double area, const std::string &description);
+             Money price, double area, const std::string &description, const allocator_type &allocator = {});
     virtual ~Property() = default;
 
     virtual std::string getType() const = 0;
     virtual void displayInfo() const = 0;
     virtual std::string toFileString() const = 0;
     virtual Property *clone() const = 0;
+    virtual size_t getObjectSize() const = 0;
 
     bool operator==(const Property &other) const;
-    std::partial_ordering operator<=>(const Property &other) const;
+    std::strong_ordering operator<=>(const Property &other) const;
 
-    std::string getId() const { return id; }
-    std::string getCity() const { return city; }
-    std::string getStreet() const { return street; }
-    std::string getHouse() const { return house; }
-    std::string getAddress() const { return city + ", " + street + ", " + house; }
-    double getPrice() const { return price; }
+    std::string getId() const { return std::string(id); }
+    std::string getCity() const { return std::string(StringPool::instance().resolve(city)); }
+    std::string getStreet() const { return std::string(StringPool::instance().resolve(street)); }
+    std::string getHouse() const { return std::string(house); }
+    std::string getAddress() const;
+    Symbol getCitySymbol() const { return city; }
+    Symbol getStreetSymbol() const { return street; }
+    Money getPrice() const { return price; }
     double getArea() const { return area; }
-    std::string getDescription() const { return description; }
+    std::string getDescription() const { return std::string(description); }
     bool getIsAvailable() const { return isAvailable; }
+    size_t getStringBytes() const;
 
-    void setPrice(double newPrice);
+    void setPrice(Money newPrice);
     void setArea(double newArea);
     void setAddress(const std::string &city, const std::string &street, const std::string &house);
     void setDescription(std::string_view newDesc);
     void setAvailable(bool available) { isAvailable = available; }
 
-    static bool validatePrice(double price);
+    static bool validatePrice(Money price);
     static bool validateArea(double area);
     static bool validateId(std::string_view id);
     static bool validateAddressPart(std::string_view part);
@@ -56,8 +65,8 @@ class Property
     friend std::ostream &operator<<(std::ostream &os, const Property &prop)
     {
         os << std::format("ID: {}\n", prop.id) << std::format("Type: {}\n", prop.getType())
-           << std::format("Address: {}, {}, {}\n", prop.city, prop.street, prop.house)
-           << std::format("Price: {:.2f} руб.\n", prop.price) << std::format("Area: {} м²\n", prop.area)
+           << std::format("Address: {}\n", prop.getAddress())
+           << std::format("Price: {} руб.\n", prop.price.toString()) << std::format("Area: {} м²\n", prop.area)
            << std::format("Description: {}\n", prop.description)
            << std::format("Available: {}", prop.isAvailable ? "Yes" : "No");
         return os;
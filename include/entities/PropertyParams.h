@@ -1,6 +1,7 @@
 #ifndef PROPERTY_PARAMS_H
 #define PROPERTY_PARAMS_H
 
+#include "../core/Money.h"
 #include <string>
 
 struct PropertyBaseParams
@@ -9,7 +10,7 @@ struct PropertyBaseParams
     std::string city;
     std::string street;
     std::string house;
-    double price;
+    Money price;
     double area;
     std::string description;
 };
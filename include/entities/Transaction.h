@@ -1,43 +1,50 @@
 #ifndef TRANSACTION_H
 #define TRANSACTION_H
 
+#include "../core/Money.h"
 #include <compare>
 #include <format>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
 class Transaction
 {
   private:
-    std::string id;
-    std::string propertyId;
-    std::string clientId;
-    std::string date;
-    double finalPrice;
-    std::string status;
-    std::string notes;
+    std::pmr::string id;
+    std::pmr::string propertyId;
+    std::pmr::string clientId;
+    std::pmr::string date;
+    Money finalPrice;
+    std::pmr::string status;
+    std::pmr::string notes;
 
   public:
-    Transaction(const std::string &id, const std::string &propertyId, const std::string &clientId, double finalPrice,
-                const std::string &status = "pending", const std::string &notes = "");
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    Transaction(const std::string &id, const std::string &propertyId, const std::string &clientId, Money finalPrice,
+                const std::string &status = "pending", const std::string &notes = "",
+                const allocator_type &allocator = {});
 
     friend std::ostream &operator<<(std::ostream &os, const Transaction &trans);
 
     bool operator==(const Transaction &other) const;
     std::strong_ordering operator<=>(const Transaction &other) const;
 
-    std::string getId() const { return id; }
-    std::string getPropertyId() const { return propertyId; }
-    std::string getClientId() const { return clientId; }
-    std::string getDate() const { return date; }
-    double getFinalPrice() const { return finalPrice; }
-    std::string getStatus() const { return status; }
-    std::string getNotes() const { return notes; }
+    std::string getId() const { return std::string(id); }
+    std::string getPropertyId() const { return std::string(propertyId); }
+    std::string getClientId() const { return std::string(clientId); }
+    std::string getDate() const { return std::string(date); }
+    Money getFinalPrice() const { return finalPrice; }
+    std::string getStatus() const { return std::string(status); }
+    std::string getNotes() const { return std::string(notes); }
+    size_t getStringBytes() const;
 
     void setStatus(std::string_view status);
-    void setFinalPrice(double price);
+    void setFinalPrice(Money price);
     void setNotes(std::string_view notes);
+    void setDate(const std::string &date);
 
     static bool validateId(std::string_view id);
 
@@ -48,7 +55,8 @@ class Transaction
     {
         os << std::format("Transaction ID: {}\n", trans.id) << std::format("Property ID: {}\n", trans.propertyId)
            << std::format("Client ID: {}\n", trans.clientId) << std::format("Date: {}\n", trans.date)
-           << std::format("Final Price: {:.2f} руб.\n", trans.finalPrice) << std::format("Status: {}\n", trans.status)
+           << std::format("Final Price: {} руб.\n", trans.finalPrice.toString())
+           << std::format("Status: {}\n", trans.status)
            << std::format("Notes: {}", trans.notes);
         return os;
     }
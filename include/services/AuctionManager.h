@@ -1,9 +1,19 @@
 #ifndef AUCTION_MANAGER_H
 #define AUCTION_MANAGER_H
 
+#include "../core/Aggregation.h"
+#include "../core/EntityArena.h"
+#include "../core/EntityCursor.h"
+#include "../core/MemoryUsage.h"
+#include "../core/ReverseIndex.h"
+#include "../core/RowDirectory.h"
+#include "../core/TopK.h"
 #include "../entities/Auction.h"
+#include "../services/PropertyManager.h"
 #include <memory>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 class AuctionManagerException : public std::exception
@@ -19,24 +29,68 @@ class AuctionManagerException : public std::exception
 class AuctionManager
 {
   private:
+    std::shared_ptr<EntityArena> arena;
     std::vector<std::shared_ptr<Auction>> auctions;
+    RowDirectory rows;
+    ReverseIndex<Auction> byProperty;
+
+    void rebuildReferences();
+    const std::shared_ptr<Auction> *findEntry(const std::string &id) const;
 
   public:
     AuctionManager();
 
     void addAuction(std::shared_ptr<Auction> auction);
     bool removeAuction(const std::string &id);
+    size_t removeAuctionsByProperty(const std::string &propertyId);
+    size_t detachAuctionsFromProperty(const std::string &propertyId);
     Auction *findAuction(const std::string &id) const;
+    std::shared_ptr<Auction> findSharedAuction(const std::string &id) const;
 
-    std::vector<Auction *> getAllAuctions() const;
+    EntityView<std::shared_ptr<Auction>> getAllAuctions() const { return makeEntityView(auctions); }
+    EntityPage<std::shared_ptr<Auction>> getPage(const PageCursor &after, size_t limit) const
+    {
+        return makePage(auctions, after, limit);
+    }
     std::vector<Auction *> getActiveAuctions() const;
     std::vector<Auction *> getCompletedAuctions() const;
     std::vector<Auction *> getAuctionsByProperty(std::string_view propertyId) const;
+    std::vector<Auction *> getMostRecent(size_t k) const;
+    std::vector<Auction *> getEndingSoonest(size_t k) const;
+
+    template <typename Less, typename Predicate = AcceptAll>
+    std::vector<Auction *> topK(size_t k, Less less, Predicate predicate = {}) const
+    {
+        return selectTopK(auctions, k, less, predicate);
+    }
+
+    template <typename KeyOf> auto aggregate(KeyOf keyOf) const
+    {
+        using Key = typename std::invoke_result_t<KeyOf &, const Auction &>::value_type;
+        return groupRows<Key>(auctions.size(),
+                              [this, &keyOf](size_t row) -> std::optional<Key>
+                              { return auctions[row] ? keyOf(*auctions[row]) : std::nullopt; },
+                              [this](AggregateStats &stats, size_t row)
+                              {
+                                  if (const Bid *highest = auctions[row]->getHighestBid(); highest != nullptr)
+                                  {
+                                      stats.add(highest->getAmount());
+                                  }
+                                  else
+                                  {
+                                      stats.addWithoutValue();
+                                  }
+                              });
+    }
+    GroupedAggregate<std::string> aggregateByStatus() const;
+    GroupedAggregate<PropertyKind> aggregateClearingByKind(const PropertyManager &properties) const;
 
     const std::vector<std::shared_ptr<Auction>> &getAuctions() const { return auctions; }
-    void setAuctions(std::vector<std::shared_ptr<Auction>> &&newAuctions) { auctions = std::move(newAuctions); }
+    void setAuctions(std::vector<std::shared_ptr<Auction>> &&newAuctions,
+                     std::shared_ptr<EntityArena> newArena = nullptr);
 
-    size_t getCount() const { return auctions.size(); }
+    size_t getCount() const { return auctions.size() - rows.getRemovedCount(); }
+    MemoryUsage getMemoryUsage() const;
 };
 
 #endif
@@ -0,0 +1,48 @@
+#ifndef AUCTION_SCHEDULER_H
+#define AUCTION_SCHEDULER_H
+
+#include "../core/TimerWheel.h"
+#include "AuctionManager.h"
+#include "PropertyManager.h"
+#include "TransactionManager.h"
+#include <ctime>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+class AuctionScheduler
+{
+  public:
+    using SettlementCallback = std::function<void(const Auction &, const Transaction *)>;
+
+  private:
+    AuctionManager &auctionManager;
+    TransactionManager &transactionManager;
+    PropertyManager &propertyManager;
+
+    TimerWheel wheel;
+    std::unordered_map<std::string, TimerWheel::TimerId> timersByAuction;
+    std::time_t snipingWindow;
+    std::time_t snipingExtension;
+    SettlementCallback settlementCallback;
+
+    void onDeadline(const std::string &auctionId);
+
+  public:
+    AuctionScheduler(AuctionManager &auctionManager, TransactionManager &transactionManager,
+                     PropertyManager &propertyManager);
+
+    void scheduleAuction(const Auction &auction);
+    void unscheduleAuction(const std::string &auctionId);
+    void rescheduleAll();
+
+    bool onBidAccepted(Auction &auction, std::time_t now);
+    size_t tick(std::time_t now);
+
+    void setAntiSniping(std::time_t window, std::time_t extension);
+    void setSettlementCallback(SettlementCallback callback) { settlementCallback = std::move(callback); }
+
+    size_t getScheduledCount() const { return timersByAuction.size(); }
+};
+
+#endif
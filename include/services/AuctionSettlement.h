@@ -0,0 +1,17 @@
+#ifndef AUCTION_SETTLEMENT_H
+#define AUCTION_SETTLEMENT_H
+
+#include "../entities/Auction.h"
+#include "../entities/Transaction.h"
+#include "PropertyManager.h"
+#include "TransactionManager.h"
+#include <memory>
+
+class AuctionSettlement
+{
+  public:
+    static std::shared_ptr<Transaction> settle(const Auction &auction, TransactionManager &transactionManager,
+                                               PropertyManager &propertyManager);
+};
+
+#endif
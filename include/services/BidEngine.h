@@ -0,0 +1,124 @@
+#ifndef BID_ENGINE_H
+#define BID_ENGINE_H
+
+#include "../core/Money.h"
+#include "AuctionManager.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class BidEngineException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit BidEngineException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+enum class BidStatus
+{
+    Accepted,
+    Buyout,
+    RejectedTooLow,
+    RejectedClosed,
+    RejectedInvalid,
+    RejectedUnknownAuction
+};
+
+struct BidRequest
+{
+    std::string auctionId;
+    std::string clientId;
+    std::string clientName;
+    Money amount;
+    uint64_t sequence = 0;
+    int64_t submittedNs = 0;
+};
+
+struct BidResult
+{
+    BidRequest request;
+    BidStatus status;
+    Money leadingBid;
+};
+
+class BidEngine
+{
+  public:
+    using ResultCallback = std::function<void(const BidResult &)>;
+
+  private:
+    struct Lot
+    {
+        std::string auctionId;
+        std::weak_ptr<Auction> auction;
+        std::mutex queueMutex;
+        std::deque<BidRequest> pending;
+        bool scheduled = false;
+    };
+
+    AuctionManager &auctionManager;
+    ResultCallback resultCallback;
+    size_t workerCount;
+
+    std::shared_mutex lotsMutex;
+    std::unordered_map<std::string, std::shared_ptr<Lot>> lots;
+    std::unordered_set<std::string> forgottenAuctions;
+
+    std::mutex readyMutex;
+    std::condition_variable readyCondition;
+    std::deque<std::shared_ptr<Lot>> readyLots;
+    bool stopping = false;
+
+    std::mutex drainMutex;
+    std::condition_variable drainCondition;
+    std::atomic<uint64_t> inFlight{0};
+
+    std::atomic<uint64_t> nextSequence{1};
+    std::atomic<uint64_t> acceptedCount{0};
+    std::atomic<uint64_t> rejectedCount{0};
+
+    std::vector<std::thread> workers;
+
+    std::shared_ptr<Lot> findOrCreateLot(const std::string &auctionId);
+    void schedule(std::shared_ptr<Lot> lot);
+    void workerLoop();
+    void processLot(const std::shared_ptr<Lot> &lot);
+    BidResult apply(Auction &auction, const BidRequest &request) const;
+    void publish(const BidResult &result);
+    void finish(size_t count);
+
+  public:
+    explicit BidEngine(AuctionManager &manager, size_t workerCount = 0);
+    ~BidEngine();
+
+    BidEngine(const BidEngine &) = delete;
+    BidEngine &operator=(const BidEngine &) = delete;
+
+    void setResultCallback(ResultCallback callback) { resultCallback = std::move(callback); }
+
+    void start();
+    void stop();
+    bool isRunning() const { return !workers.empty(); }
+
+    uint64_t submit(BidRequest request);
+    void drain();
+    void forgetAuction(const std::string &auctionId);
+
+    uint64_t getAcceptedCount() const { return acceptedCount.load(std::memory_order_relaxed); }
+    uint64_t getRejectedCount() const { return rejectedCount.load(std::memory_order_relaxed); }
+};
+
+#endif
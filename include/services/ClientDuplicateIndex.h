@@ -0,0 +1,67 @@
+#ifndef CLIENT_DUPLICATE_INDEX_H
+#define CLIENT_DUPLICATE_INDEX_H
+
+#include "../entities/Client.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct DuplicateCandidate
+{
+    uint32_t row = 0;
+    double score = 0.0;
+};
+
+struct DuplicateRowPair
+{
+    uint32_t first = 0;
+    uint32_t second = 0;
+    double score = 0.0;
+};
+
+class ClientDuplicateIndex
+{
+  public:
+    static constexpr size_t MAX_BLOCK_SIZE = 256;
+    static constexpr size_t PHONETIC_KEY_LENGTH = 6;
+    static constexpr double NAME_WEIGHT = 0.5;
+    static constexpr double PHONE_WEIGHT = 0.3;
+    static constexpr double EMAIL_WEIGHT = 0.3;
+    static constexpr double DEFAULT_THRESHOLD = 0.75;
+
+  private:
+    struct Fingerprint
+    {
+        std::u32string name;
+        std::string phone;
+        std::string emailLocal;
+        std::string emailDomain;
+    };
+
+    std::vector<Fingerprint> fingerprints;
+    std::unordered_map<std::string, std::vector<uint32_t>> blocks;
+
+    static Fingerprint makeFingerprint(const Client &client);
+    static std::vector<std::string> getBlockKeys(const Fingerprint &fingerprint);
+    static double score(const Fingerprint &left, const Fingerprint &right, double threshold);
+
+  public:
+    static std::u32string normalizeName(std::string_view name);
+    static std::string phoneticKey(std::u32string_view normalizedName);
+    static size_t editDistance(std::u32string_view left, std::u32string_view right);
+
+    void rebuild(const std::vector<std::shared_ptr<Client>> &clients);
+    void add(const Client &client);
+    std::vector<DuplicateCandidate> findMatches(const Client &client, double threshold = DEFAULT_THRESHOLD) const;
+    std::vector<DuplicateRowPair> findAllPairs(double threshold = DEFAULT_THRESHOLD) const;
+
+    size_t size() const { return fingerprints.size(); }
+    size_t getBlockCount() const { return blocks.size(); }
+    size_t getMemoryBytes() const;
+};
+
+#endif
@@ -1,8 +1,13 @@
 #ifndef CLIENT_MANAGER_H
 #define CLIENT_MANAGER_H
 
+#include "../core/EntityArena.h"
+#include "../core/EntityCursor.h"
+#include "../core/MemoryUsage.h"
 #include "../entities/Client.h"
+#include "../services/ClientDuplicateIndex.h"
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -17,10 +22,32 @@ class ClientManagerException : public std::exception
     const char *what() const noexcept override { return message.c_str(); }
 };
 
+struct DuplicateMatch
+{
+    Client *client = nullptr;
+    double score = 0.0;
+};
+
+struct DuplicatePair
+{
+    Client *first = nullptr;
+    Client *second = nullptr;
+    double score = 0.0;
+};
+
 class ClientManager
 {
   private:
+    std::shared_ptr<EntityArena> arena;
     std::vector<std::shared_ptr<Client>> clients;
+    mutable std::mutex idRowsMutex;
+    mutable std::shared_ptr<const IdRows> idRows;
+    mutable std::mutex duplicatesMutex;
+    mutable std::unique_ptr<ClientDuplicateIndex> duplicates;
+
+    void invalidateIdRows();
+    void invalidateDuplicates();
+    const ClientDuplicateIndex &getDuplicateIndex() const;
 
   public:
     ClientManager();
@@ -29,14 +56,23 @@ class ClientManager
     bool removeClient(const std::string &id);
     Client *findClient(const std::string &id) const;
 
-    std::vector<Client *> getAllClients() const;
+    EntityView<std::shared_ptr<Client>> getAllClients() const { return makeEntityView(clients); }
+    EntityPage<std::shared_ptr<Client>> getPage(const PageCursor &after, size_t limit) const
+    {
+        return makePage(clients, after, limit);
+    }
     std::vector<Client *> searchByName(std::string_view name) const;
     std::vector<Client *> searchByPhone(std::string_view phone) const;
+    std::vector<DuplicateMatch> findDuplicates(const Client &client,
+                                               double threshold = ClientDuplicateIndex::DEFAULT_THRESHOLD) const;
+    std::vector<DuplicatePair> findAllDuplicates(double threshold = ClientDuplicateIndex::DEFAULT_THRESHOLD) const;
 
     const std::vector<std::shared_ptr<Client>> &getClients() const { return clients; }
-    void setClients(std::vector<std::shared_ptr<Client>> &&newClients) { clients = std::move(newClients); }
+    std::shared_ptr<const IdRows> getIdRows() const;
+    void setClients(std::vector<std::shared_ptr<Client>> &&newClients, std::shared_ptr<EntityArena> newArena = nullptr);
 
     size_t getCount() const { return clients.size(); }
+    MemoryUsage getMemoryUsage() const;
 };
 
 #endif
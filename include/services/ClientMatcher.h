@@ -0,0 +1,96 @@
+#ifndef CLIENT_MATCHER_H
+#define CLIENT_MATCHER_H
+
+#include "../core/IntervalTree.h"
+#include "../core/MemoryUsage.h"
+#include "../core/Money.h"
+#include "../core/StringPool.h"
+#include "../entities/Property.h"
+#include "../services/PropertyColumns.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ClientMatcherException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit ClientMatcherException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+struct SearchProfile
+{
+    uint32_t id = 0;
+    std::string clientId;
+    std::optional<Money> minPrice;
+    std::optional<Money> maxPrice;
+    std::optional<double> minArea;
+    std::optional<double> maxArea;
+    std::optional<Symbol> city;
+    std::optional<PropertyKind> kind;
+    std::optional<int> minRooms;
+    std::optional<int> maxRooms;
+    bool needsParking = false;
+
+    bool matches(const Property &property) const;
+    static bool hasParking(const Property &property);
+};
+
+class ClientMatcher
+{
+  public:
+    using MatchCallback = std::function<void(const Property &, const std::vector<const SearchProfile *> &)>;
+
+    static constexpr size_t MIN_PENDING_PROFILES = 1024;
+    static constexpr size_t PENDING_FRACTION = 16;
+
+  private:
+    struct MatchIndex
+    {
+        std::unordered_map<uint64_t, IntervalTree<uint32_t>> buckets;
+        size_t rows = 0;
+    };
+
+    std::vector<SearchProfile> profiles;
+    std::vector<bool> removedRows;
+    size_t removedCount = 0;
+    std::unordered_map<uint32_t, uint32_t> profileRows;
+    std::unordered_map<std::string, std::vector<uint32_t>> profilesByClient;
+    uint32_t nextId = 1;
+    MatchCallback matchCallback;
+    mutable std::mutex indexMutex;
+    mutable std::shared_ptr<const MatchIndex> index;
+
+    std::shared_ptr<const MatchIndex> getIndex() const;
+    void rebuildRows();
+    void markRemoved(uint32_t row);
+    void compactIfNeeded();
+
+  public:
+    uint32_t addProfile(SearchProfile profile);
+    bool removeProfile(uint32_t id);
+    size_t removeProfilesByClient(const std::string &clientId);
+    const SearchProfile *findProfile(uint32_t id) const;
+    std::vector<const SearchProfile *> getProfilesByClient(const std::string &clientId) const;
+
+    std::vector<const SearchProfile *> match(const Property &property) const;
+    void setMatchCallback(MatchCallback callback) { matchCallback = std::move(callback); }
+    void notifyPropertyChanged(const Property &property) const;
+
+    std::vector<const SearchProfile *> getProfiles() const;
+    void setProfiles(std::vector<SearchProfile> &&newProfiles);
+
+    size_t getCount() const { return profiles.size() - removedCount; }
+    MemoryUsage getMemoryUsage() const;
+};
+
+#endif
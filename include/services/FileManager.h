@@ -10,6 +10,7 @@
 #include "../entities/Property.h"
 #include "../entities/Transaction.h"
 #include "../services/AuctionManager.h"
+#include "../services/ClientMatcher.h"
 #include "../services/ClientManager.h"
 #include "../services/PropertyManager.h"
 #include "../services/TransactionManager.h"
@@ -36,19 +37,23 @@ class FileManager
     static constexpr char UNAVAILABLE_CHAR = '0';
     static constexpr size_t BID_PREFIX_LENGTH = 4;
 
-    static void parseBidLine(std::string_view line, Auction *currentAuction);
-    static std::shared_ptr<Auction> parseAuctionLine(std::string_view line);
+    static void parseBidLine(std::string_view line, Auction *currentAuction, EntityArena &arena);
+    static std::shared_ptr<Auction> parseAuctionLine(std::string_view line, EntityArena &arena);
 
   public:
     static void saveProperties(const PropertyManager &manager, const std::string &filename);
     static void saveClients(const ClientManager &manager, const std::string &filename);
     static void saveTransactions(const TransactionManager &manager, const std::string &filename);
     static void saveAuctions(const AuctionManager &manager, const std::string &filename);
+    static void savePriceHistory(const PropertyManager &manager, const std::string &filename);
+    static void saveSearchProfiles(const ClientMatcher &matcher, const std::string &filename);
 
     static void loadProperties(PropertyManager &manager, const std::string &filename);
     static void loadClients(ClientManager &manager, const std::string &filename);
     static void loadTransactions(TransactionManager &manager, const std::string &filename);
     static void loadAuctions(AuctionManager &manager, const std::string &filename);
+    static void loadPriceHistory(PropertyManager &manager, const std::string &filename);
+    static void loadSearchProfiles(ClientMatcher &matcher, const std::string &filename);
 };
 
 #endif
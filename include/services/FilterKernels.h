@@ -0,0 +1,77 @@
+#ifndef FILTER_KERNELS_H
+#define FILTER_KERNELS_H
+
+#include "../core/StringPool.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+enum class SimdLevel
+{
+    Scalar,
+    Sse42,
+    Avx2
+};
+
+class SelectionBitmap
+{
+  private:
+    std::vector<uint64_t> words;
+    size_t rowCount = 0;
+
+  public:
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    explicit SelectionBitmap(size_t rows = 0) { reset(rows); }
+
+    void reset(size_t rows);
+
+    uint64_t *data() { return words.data(); }
+    const uint64_t *data() const { return words.data(); }
+    size_t size() const { return rowCount; }
+    size_t getWordCount() const { return words.size(); }
+    size_t count() const;
+    size_t findNext(size_t from) const;
+    bool test(size_t row) const { return (words[row / BITS_PER_WORD] >> (row % BITS_PER_WORD)) & 1U; }
+
+    template <typename Visitor> void forEach(Visitor &&visitor) const
+    {
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            uint64_t word = words[w];
+            while (word != 0)
+            {
+                visitor(w * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+struct FilterKernels
+{
+    using Int64Range = void (*)(const int64_t *values, size_t count, int64_t low, int64_t high, uint64_t *bits);
+    using DoubleRange = void (*)(const double *values, size_t count, double low, double high, uint64_t *bits);
+    using ByteEqual = void (*)(const uint8_t *values, size_t count, uint8_t wanted, uint64_t *bits);
+    using SymbolEqual = void (*)(const Symbol *values, size_t count, Symbol wanted, uint64_t *bits);
+    using Int32AtLeast = void (*)(const int32_t *values, size_t count, int32_t low, uint64_t *bits);
+
+    SimdLevel level;
+    Int64Range int64Range;
+    DoubleRange doubleRange;
+    ByteEqual byteEqual;
+    SymbolEqual symbolEqual;
+    Int32AtLeast int32AtLeast;
+
+    static SimdLevel detectLevel();
+    static bool isSupported(SimdLevel level);
+    static const FilterKernels &forLevel(SimdLevel level);
+    static const FilterKernels &active();
+    static const char *getLevelName(SimdLevel level);
+    static std::optional<SimdLevel> parseLevel(std::string_view name);
+};
+
+#endif
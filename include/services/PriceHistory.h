@@ -0,0 +1,72 @@
+#ifndef PRICE_HISTORY_H
+#define PRICE_HISTORY_H
+
+#include "../core/Money.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct PricePoint
+{
+    std::time_t time = 0;
+    Money price;
+};
+
+struct PriceChange
+{
+    std::string propertyId;
+    std::time_t time = 0;
+    Money oldPrice;
+    Money newPrice;
+};
+
+class PriceHistory
+{
+  public:
+    static constexpr size_t BLOCK_BYTES = 32;
+    static constexpr std::time_t UNKNOWN_TIME = 0;
+
+  private:
+    static constexpr uint32_t NO_BLOCK = UINT32_MAX;
+
+    struct Series
+    {
+        uint32_t firstBlock = NO_BLOCK;
+        uint32_t lastBlock = NO_BLOCK;
+        uint32_t count = 0;
+        int64_t lastTime = 0;
+        int64_t lastPrice = 0;
+    };
+
+    std::vector<uint8_t> blocks;
+    std::unordered_map<std::string, Series> series;
+    std::vector<uint32_t> freeBlocks;
+    size_t pointCount = 0;
+
+    uint32_t allocateBlock();
+    void visit(const Series &entry, const std::function<void(const PricePoint &)> &visitor) const;
+
+  public:
+    void record(const std::string &propertyId, std::time_t time, Money price);
+    size_t erase(const std::string &propertyId);
+    void clear();
+
+    bool contains(const std::string &propertyId) const { return series.contains(propertyId); }
+    std::vector<std::string> getPropertyIds() const;
+    std::vector<PricePoint> getHistory(const std::string &propertyId) const;
+    std::optional<Money> getPriceAt(const std::string &propertyId, std::time_t time) const;
+    std::vector<PriceChange> getChanges(const std::string &propertyId, std::time_t from, std::time_t to) const;
+    std::vector<PriceChange> getChanges(std::time_t from, std::time_t to) const;
+
+    size_t getSeriesCount() const { return series.size(); }
+    size_t getPointCount() const { return pointCount; }
+    size_t getEncodedBytes() const { return blocks.size(); }
+    size_t getMemoryBytes() const;
+};
+
+#endif
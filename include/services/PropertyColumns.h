@@ -0,0 +1,82 @@
+#ifndef PROPERTY_COLUMNS_H
+#define PROPERTY_COLUMNS_H
+
+#include "../core/MemoryUsage.h"
+#include "../core/Money.h"
+#include "../core/StringPool.h"
+#include "../entities/Property.h"
+#include "../services/FilterKernels.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+enum class PropertyKind : uint8_t
+{
+    Apartment,
+    House,
+    Commercial
+};
+
+struct PropertyFilter
+{
+    std::optional<Money> minPrice;
+    std::optional<Money> maxPrice;
+    std::optional<double> minArea;
+    std::optional<double> maxArea;
+    std::optional<bool> available;
+    std::optional<PropertyKind> kind;
+    std::optional<Symbol> city;
+    std::optional<int> minRooms;
+};
+
+struct PropertyAggregate
+{
+    size_t count = 0;
+    Money totalPrice;
+    Money minPrice;
+    Money maxPrice;
+    double totalArea = 0.0;
+
+    Money getAveragePrice() const { return count > 0 ? totalPrice.scaled(1, static_cast<int64_t>(count)) : Money(); }
+};
+
+class PropertyColumns
+{
+  private:
+    std::vector<int64_t> prices;
+    std::vector<double> areas;
+    std::vector<uint8_t> available;
+    std::vector<PropertyKind> kinds;
+    std::vector<Symbol> cities;
+    std::vector<int32_t> rooms;
+
+  public:
+    static PropertyKind kindOf(const Property &property);
+    static int roomsOf(const Property &property);
+
+    void clear();
+    void reserve(size_t count);
+    void append(const Property &property);
+    void erase(size_t row);
+    void setAvailable(size_t row, bool value) { available[row] = value ? 1 : 0; }
+    void setPrice(size_t row, Money value) { prices[row] = value.getKopecks(); }
+
+    size_t size() const { return prices.size(); }
+    std::span<const int64_t> getPrices() const { return prices; }
+    std::span<const double> getAreas() const { return areas; }
+    std::span<const uint8_t> getAvailability() const { return available; }
+    std::span<const PropertyKind> getKinds() const { return kinds; }
+    std::span<const Symbol> getCities() const { return cities; }
+    std::span<const int32_t> getRooms() const { return rooms; }
+
+    SelectionBitmap evaluate(const PropertyFilter &filter) const;
+    SelectionBitmap evaluate(const PropertyFilter &filter, const FilterKernels &kernels) const;
+    bool matches(size_t row, const PropertyFilter &filter) const;
+    std::vector<uint32_t> select(const PropertyFilter &filter) const;
+    size_t count(const PropertyFilter &filter) const { return evaluate(filter).count(); }
+    PropertyAggregate aggregate(const PropertyFilter &filter) const;
+    size_t getMemoryBytes() const;
+};
+
+#endif
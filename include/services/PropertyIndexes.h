@@ -0,0 +1,40 @@
+#ifndef PROPERTY_INDEXES_H
+#define PROPERTY_INDEXES_H
+
+#include "../core/EntityArena.h"
+#include "../core/EntityCursor.h"
+#include "../core/MemoryUsage.h"
+#include "../core/StringPool.h"
+#include "../entities/Property.h"
+#include "../services/PropertyColumns.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using RowList = std::vector<uint32_t>;
+using SymbolPostings = std::unordered_map<Symbol, RowList>;
+
+class PropertyIndexes
+{
+  private:
+    mutable std::mutex mutex;
+    mutable std::shared_ptr<const RowList> priceOrder;
+    mutable std::shared_ptr<const RowList> areaOrder;
+    mutable std::shared_ptr<const SymbolPostings> cityPostings;
+    mutable std::shared_ptr<const IdRows> idRows;
+
+  public:
+    void invalidate();
+
+    std::shared_ptr<const RowList> getPriceOrder(const PropertyColumns &columns) const;
+    std::shared_ptr<const RowList> getAreaOrder(const PropertyColumns &columns) const;
+    std::shared_ptr<const SymbolPostings> getCityPostings(const PropertyColumns &columns) const;
+    std::shared_ptr<const IdRows> getIdRows(const std::vector<ArenaPtr<Property>> &properties) const;
+
+    size_t getMemoryBytes() const;
+};
+
+#endif
@@ -1,12 +1,24 @@
 #ifndef PROPERTY_MANAGER_H
 #define PROPERTY_MANAGER_H
 
+#include "../core/Aggregation.h"
+#include "../core/EntityArena.h"
+#include "../core/EntityCursor.h"
+#include "../core/MemoryUsage.h"
 #include "../entities/Property.h"
 #include "../entities/PropertyParams.h"
+#include "../services/PriceHistory.h"
+#include "../services/PropertyColumns.h"
+#include "../services/PropertyIndexes.h"
+#include "../services/PropertyQuery.h"
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class PropertyManagerException : public std::exception
@@ -55,32 +67,71 @@ template <typename T> class ContainerManager
     typename std::vector<std::shared_ptr<T>>::const_iterator end() const { return items.end(); }
 };
 
+using PropertyPtr = ArenaPtr<Property>;
+
 class PropertyManager
 {
+  public:
+    using ChangeCallback = std::function<void(const Property &)>;
+
   private:
-    std::vector<std::unique_ptr<Property>> properties;
+    std::shared_ptr<EntityArena> arena;
+    std::vector<PropertyPtr> properties;
+    PropertyColumns columns;
+    PropertyIndexes indexes;
+    PriceHistory priceHistory;
+    ChangeCallback changeCallback;
+    mutable std::mutex liveStatsMutex;
+    mutable LiveAggregate<Symbol> liveStatsByCity;
+
+    EntityArena &getArena();
+    GroupedAggregate<Symbol> groupPricesByCity(const PropertyFilter &filter) const;
+    std::vector<Property *> collectRows(const std::vector<uint32_t> &rows) const;
 
   public:
     PropertyManager();
 
-    void addProperty(std::unique_ptr<Property> property);
+    void addProperty(PropertyPtr property);
     void addApartment(const ApartmentParams &params);
     void addHouse(const HouseParams &params);
     void addCommercialProperty(const CommercialPropertyParams &params);
 
     bool removeProperty(const std::string &id);
     Property *findProperty(const std::string &id) const;
+    void setAvailable(const Property *property, bool available);
+    void setPrice(const Property *property, Money price);
+    void setChangeCallback(ChangeCallback callback) { changeCallback = std::move(callback); }
 
-    std::vector<Property *> getAllProperties() const;
+    EntityView<PropertyPtr> getAllProperties() const { return makeEntityView(properties); }
+    EntityPage<PropertyPtr> getPage(const PageCursor &after, size_t limit) const
+    {
+        return makePage(properties, after, limit);
+    }
     std::vector<Property *> getAvailableProperties() const;
-    std::vector<Property *> searchByPriceRange(double minPrice, double maxPrice) const;
+    std::vector<Property *> searchByPriceRange(Money minPrice, Money maxPrice) const;
     std::vector<Property *> searchByAddress(const std::string &city, const std::string &street = "",
                                             const std::string &house = "") const;
-
-    const std::vector<std::unique_ptr<Property>> &getProperties() const { return properties; }
-    void setProperties(std::vector<std::unique_ptr<Property>> &&props) { properties = std::move(props); }
+    std::vector<Property *> searchByCity(std::string_view city) const;
+    std::unordered_map<Symbol, size_t> countByCity() const;
+    std::vector<Property *> search(const PropertyFilter &filter) const;
+    PropertyAggregate aggregate(const PropertyFilter &filter) const;
+    GroupedAggregate<std::string> aggregateByCity(const PropertyFilter &filter = {}) const;
+    GroupedAggregate<PropertyKind> aggregateByKind(const PropertyFilter &filter = {}) const;
+    GroupedAggregate<std::string> getLiveStatsByCity() const;
+    PropertyQueryResult query(const PropertyQuery &query) const;
+    std::vector<Property *> topK(const PropertyFilter &filter, size_t k, PropertyField field = PropertyField::Price,
+                                 bool descending = false) const;
+
+    const std::vector<PropertyPtr> &getProperties() const { return properties; }
+    const PropertyColumns &getColumns() const { return columns; }
+    std::shared_ptr<const IdRows> getIdRows() const { return indexes.getIdRows(properties); }
+    void setProperties(std::vector<PropertyPtr> &&props, std::shared_ptr<EntityArena> newArena = nullptr);
+    const PriceHistory &getPriceHistory() const { return priceHistory; }
+    void setPriceHistory(PriceHistory &&history) { priceHistory = std::move(history); }
+    size_t erasePriceHistory(const std::string &propertyId) { return priceHistory.erase(propertyId); }
 
     size_t getCount() const { return properties.size(); }
+    MemoryUsage getMemoryUsage() const;
 };
 
 #endif
@@ -0,0 +1,173 @@
+#ifndef PROPERTY_QUERY_H
+#define PROPERTY_QUERY_H
+
+#include "../core/EntityArena.h"
+#include "../core/Money.h"
+#include "../entities/Property.h"
+#include "../services/FilterKernels.h"
+#include "../services/PropertyColumns.h"
+#include "../services/PropertyIndexes.h"
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+class PropertyQueryException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit PropertyQueryException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+enum class PropertyField
+{
+    Id,
+    City,
+    Street,
+    House,
+    Price,
+    Area,
+    Available,
+    Kind,
+    Rooms,
+    Floor,
+    HasBalcony,
+    HasElevator,
+    Floors,
+    LandArea,
+    HasGarage,
+    HasGarden,
+    BusinessType,
+    HasParking,
+    ParkingSpaces,
+    IsVisibleFromStreet
+};
+
+enum class QueryOp
+{
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Between,
+    Contains
+};
+
+using QueryValue = std::variant<std::monostate, Money, double, bool, std::string, PropertyKind>;
+
+struct QueryPredicate
+{
+    PropertyField field;
+    QueryOp op;
+    QueryValue value;
+    QueryValue upper;
+};
+
+struct QuerySort
+{
+    PropertyField field;
+    bool descending = false;
+};
+
+class PropertyQuery
+{
+  private:
+    std::vector<QueryPredicate> predicates;
+    std::optional<QuerySort> sort;
+    size_t offsetRows = 0;
+    std::optional<size_t> limitRows;
+
+  public:
+    PropertyQuery &where(PropertyField field, QueryOp op, QueryValue value);
+    PropertyQuery &between(PropertyField field, QueryValue low, QueryValue high);
+    PropertyQuery &orderBy(PropertyField field, bool descending = false);
+    PropertyQuery &offset(size_t rows);
+    PropertyQuery &limit(size_t rows);
+
+    const std::vector<QueryPredicate> &getPredicates() const { return predicates; }
+    const std::optional<QuerySort> &getSort() const { return sort; }
+    size_t getOffset() const { return offsetRows; }
+    const std::optional<size_t> &getLimit() const { return limitRows; }
+
+    static PropertyQuery fromFilter(const PropertyFilter &filter);
+    static std::string_view getFieldName(PropertyField field);
+    static std::optional<QueryValue> readField(const Property &property, PropertyField field);
+};
+
+class PropertyQueryResult
+{
+  private:
+    const std::vector<ArenaPtr<Property>> *properties = nullptr;
+    const PropertyColumns *columns = nullptr;
+    std::shared_ptr<const RowList> rows;
+    size_t rowsBegin = 0;
+    size_t rowsEnd = 0;
+    bool reversed = false;
+    std::optional<SelectionBitmap> selection;
+    std::optional<PropertyFilter> rowFilter;
+    std::vector<QueryPredicate> residual;
+    size_t offsetRows = 0;
+    std::optional<size_t> limitRows;
+    std::string plan;
+    size_t estimatedRows = 0;
+
+    friend class PropertyQueryPlanner;
+
+    size_t findCandidate(size_t cursor) const;
+    uint32_t rowAt(size_t cursor) const;
+    bool accepts(uint32_t row) const;
+
+  public:
+    static constexpr size_t END = static_cast<size_t>(-1);
+
+    class Iterator
+    {
+      private:
+        const PropertyQueryResult *result = nullptr;
+        size_t cursor = END;
+        size_t produced = 0;
+
+        void seek(size_t from);
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Property *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Property *const *;
+        using reference = Property *;
+
+        Iterator() = default;
+        Iterator(const PropertyQueryResult *result, size_t cursor);
+
+        Property *operator*() const;
+        Iterator &operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator &other) const { return cursor == other.cursor; }
+    };
+
+    Iterator begin() const;
+    Iterator end() const { return {}; }
+
+    std::vector<Property *> toVector() const;
+    size_t count() const;
+    const std::string &explain() const { return plan; }
+    size_t getEstimatedRows() const { return estimatedRows; }
+};
+
+class PropertyQueryPlanner
+{
+  public:
+    static PropertyQueryResult plan(const PropertyQuery &query, const std::vector<ArenaPtr<Property>> &properties,
+                                    const PropertyColumns &columns, const PropertyIndexes &indexes);
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef PROXY_BIDDING_H
+#define PROXY_BIDDING_H
+
+#include "../core/Money.h"
+#include "AuctionManager.h"
+#include <cstdint>
+#include <optional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ProxyBiddingException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit ProxyBiddingException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+struct ProxyBid
+{
+    std::string clientId;
+    std::string clientName;
+    Money maxAmount;
+    uint64_t sequence = 0;
+};
+
+class ProxyBidding
+{
+  private:
+    struct Priority
+    {
+        bool operator()(const ProxyBid &a, const ProxyBid &b) const
+        {
+            if (a.maxAmount != b.maxAmount)
+                return a.maxAmount < b.maxAmount;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    struct Book
+    {
+        std::priority_queue<ProxyBid, std::vector<ProxyBid>, Priority> heap;
+        std::unordered_map<std::string, ProxyBid> live;
+    };
+
+    AuctionManager &auctionManager;
+    std::unordered_map<std::string, Book> books;
+    uint64_t nextSequence = 1;
+
+    static bool isLive(const Book &book, const ProxyBid &proxy);
+    static void prune(Book &book);
+    static void dropExhausted(Book &book, const Auction &auction);
+    static bool placeBid(Auction &auction, const ProxyBid &proxy, Money amount);
+
+  public:
+    explicit ProxyBidding(AuctionManager &manager) : auctionManager(manager) {}
+
+    size_t registerProxy(const std::string &auctionId, const std::string &clientId, const std::string &clientName,
+                         Money maxAmount);
+    bool withdrawProxy(const std::string &auctionId, const std::string &clientId);
+    size_t resolve(Auction &auction);
+    void forgetAuction(const std::string &auctionId) { books.erase(auctionId); }
+
+    std::optional<Money> getProxyMaximum(const std::string &auctionId, const std::string &clientId) const;
+    size_t getProxyCount(const std::string &auctionId) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef REFERENTIAL_INTEGRITY_H
+#define REFERENTIAL_INTEGRITY_H
+
+#include "AuctionManager.h"
+#include "AuctionScheduler.h"
+#include "ClientManager.h"
+#include "ClientMatcher.h"
+#include "PropertyManager.h"
+#include "ProxyBidding.h"
+#include "TransactionManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ReferentialIntegrityException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit ReferentialIntegrityException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+enum class DeletePolicy : uint8_t
+{
+    Restrict,
+    Cascade,
+    Nullify
+};
+
+struct Dependents
+{
+    std::vector<Transaction *> transactions;
+    std::vector<Auction *> auctions;
+
+    bool empty() const { return transactions.empty() && auctions.empty(); }
+};
+
+struct DeleteResult
+{
+    bool removed = false;
+    size_t transactionsRemoved = 0;
+    size_t auctionsRemoved = 0;
+    size_t auctionsDetached = 0;
+    size_t profilesRemoved = 0;
+    size_t pricePointsRemoved = 0;
+};
+
+class ReferentialIntegrity
+{
+  private:
+    PropertyManager &propertyManager;
+    ClientManager &clientManager;
+    TransactionManager &transactionManager;
+    AuctionManager &auctionManager;
+    ClientMatcher &clientMatcher;
+    AuctionScheduler &auctionScheduler;
+    ProxyBidding &proxyBidding;
+
+    void releaseAuctions(const std::vector<Auction *> &auctions, bool cancel);
+
+  public:
+    ReferentialIntegrity(PropertyManager &propertyManager, ClientManager &clientManager,
+                         TransactionManager &transactionManager, AuctionManager &auctionManager,
+                         ClientMatcher &clientMatcher, AuctionScheduler &auctionScheduler, ProxyBidding &proxyBidding);
+
+    Dependents getPropertyDependents(const std::string &propertyId) const;
+    Dependents getClientDependents(const std::string &clientId) const;
+
+    DeleteResult removeProperty(const std::string &propertyId, DeletePolicy policy = DeletePolicy::Restrict);
+    DeleteResult removeClient(const std::string &clientId, DeletePolicy policy = DeletePolicy::Restrict);
+};
+
+#endif
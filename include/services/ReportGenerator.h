@@ -0,0 +1,65 @@
+#ifndef REPORT_GENERATOR_H
+#define REPORT_GENERATOR_H
+
+#include "../services/AuctionManager.h"
+#include "../services/ClientManager.h"
+#include "../services/PropertyManager.h"
+#include "../services/TransactionManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class ReportGeneratorException : public std::exception
+{
+  private:
+    std::string message;
+
+  public:
+    explicit ReportGeneratorException(const std::string &msg) : message(msg) {}
+    const char *what() const noexcept override { return message.c_str(); }
+};
+
+enum class ReportFormat : uint8_t
+{
+    Csv,
+    Html
+};
+
+enum class ReportPeriod : uint8_t
+{
+    Day,
+    Month,
+    Year
+};
+
+struct ReportSummary
+{
+    size_t rows = 0;
+    size_t bytes = 0;
+};
+
+class ReportGenerator
+{
+  private:
+    const PropertyManager &propertyManager;
+    const ClientManager &clientManager;
+    const TransactionManager &transactionManager;
+    const AuctionManager &auctionManager;
+
+  public:
+    static constexpr size_t ROWS_PER_BLOCK = 65536;
+
+    ReportGenerator(const PropertyManager &properties, const ClientManager &clients,
+                    const TransactionManager &transactions, const AuctionManager &auctions);
+
+    static ReportFormat formatFromFilename(std::string_view filename);
+
+    ReportSummary writeSales(const std::string &filename, ReportFormat format, std::string_view datePrefix = {}) const;
+    ReportSummary writeSalesByPeriod(const std::string &filename, ReportFormat format,
+                                     ReportPeriod period = ReportPeriod::Month, std::string_view status = {}) const;
+    ReportSummary writeSalesByStatus(const std::string &filename, ReportFormat format) const;
+    ReportSummary writeAuctionOutcomes(const std::string &filename, ReportFormat format) const;
+};
+
+#endif
@@ -1,10 +1,20 @@
 #ifndef TRANSACTION_MANAGER_H
 #define TRANSACTION_MANAGER_H
 
+#include "../core/Aggregation.h"
+#include "../core/EntityArena.h"
+#include "../core/EntityCursor.h"
+#include "../core/MemoryUsage.h"
+#include "../core/ReverseIndex.h"
+#include "../core/RowDirectory.h"
+#include "../core/TopK.h"
 #include "../entities/Transaction.h"
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 class TransactionManagerException : public std::exception
@@ -20,27 +30,64 @@ class TransactionManagerException : public std::exception
 class TransactionManager
 {
   private:
+    std::shared_ptr<EntityArena> arena;
     std::vector<std::shared_ptr<Transaction>> transactions;
+    RowDirectory rows;
+    mutable std::mutex dateOrderMutex;
+    mutable std::shared_ptr<const std::vector<uint32_t>> dateOrder;
+    ReverseIndex<Transaction> byProperty;
+    ReverseIndex<Transaction> byClient;
+
+    std::shared_ptr<const std::vector<uint32_t>> getDateOrder() const;
+    void invalidateDateOrder();
+    void rebuildReferences();
+    void compactIfNeeded();
+    size_t eraseTransactions(const std::vector<Transaction *> &removed);
 
   public:
     TransactionManager();
 
     void addTransaction(std::shared_ptr<Transaction> transaction);
     bool removeTransaction(const std::string &id);
+    size_t removeTransactionsByProperty(const std::string &propertyId);
+    size_t removeTransactionsByClient(const std::string &clientId);
     Transaction *findTransaction(const std::string &id) const;
 
-    std::vector<Transaction *> getAllTransactions() const;
+    EntityView<std::shared_ptr<Transaction>> getAllTransactions() const { return makeEntityView(transactions); }
+    EntityPage<std::shared_ptr<Transaction>> getPage(const PageCursor &after, size_t limit) const
+    {
+        return makePage(transactions, after, limit);
+    }
     std::vector<Transaction *> getTransactionsByClient(std::string_view clientId) const;
     std::vector<Transaction *> getTransactionsByProperty(std::string_view propertyId) const;
     std::vector<Transaction *> getTransactionsByStatus(std::string_view status) const;
+    std::vector<Transaction *> getMostRecent(size_t k, std::string_view status = {}) const;
 
-    const std::vector<std::shared_ptr<Transaction>> &getTransactions() const { return transactions; }
-    void setTransactions(std::vector<std::shared_ptr<Transaction>> &&newTransactions)
+    template <typename Less, typename Predicate = AcceptAll>
+    std::vector<Transaction *> topK(size_t k, Less less, Predicate predicate = {}) const
     {
-        transactions = std::move(newTransactions);
+        return selectTopK(transactions, k, less, predicate);
     }
 
-    size_t getCount() const { return transactions.size(); }
+    template <typename KeyOf> auto aggregate(KeyOf keyOf) const
+    {
+        using Key = typename std::invoke_result_t<KeyOf &, const Transaction &>::value_type;
+        return groupRows<Key>(
+            transactions.size(),
+            [this, &keyOf](size_t row) -> std::optional<Key>
+            { return transactions[row] ? keyOf(*transactions[row]) : std::nullopt; },
+            [this](AggregateStats &stats, size_t row) { stats.add(transactions[row]->getFinalPrice()); });
+    }
+    GroupedAggregate<std::string> aggregateByDatePrefix(size_t length, std::string_view status = {}) const;
+    GroupedAggregate<std::string> aggregateByMonth(std::string_view status = {}) const;
+    GroupedAggregate<std::string> aggregateByStatus() const;
+
+    const std::vector<std::shared_ptr<Transaction>> &getTransactions() const { return transactions; }
+    void setTransactions(std::vector<std::shared_ptr<Transaction>> &&newTransactions,
+                         std::shared_ptr<EntityArena> newArena = nullptr);
+
+    size_t getCount() const { return transactions.size() - rows.getRemovedCount(); }
+    MemoryUsage getMemoryUsage() const;
 };
 
 #endif
@@ -3,6 +3,7 @@
 
 #include "../core/EstateAgency.h"
 #include "../entities/Auction.h"
+#include <QCheckBox>
 #include <QComboBox>
 #include <QDialog>
 #include <QDialogButtonBox>
@@ -11,6 +12,7 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QSpinBox>
 #include <QTableWidget>
 #include <QTextEdit>
 #include <QVBoxLayout>
@@ -26,7 +28,8 @@ class AuctionDialog : public QDialog
 
     QString getId() const;
     QString getPropertyId() const;
-    double getStartingPrice() const;
+    Money getStartingPrice() const;
+    int getDurationHours() const;
 
     void refreshBids();
     void updateAuctionInfo();
@@ -51,16 +54,19 @@ class AuctionDialog : public QDialog
     QLineEdit *idEdit;
     QComboBox *propertyCombo;
     QDoubleSpinBox *priceSpin;
+    QSpinBox *durationSpin = nullptr;
     QLabel *propertyPriceLabel;
     QLabel *buyoutPriceLabel;
     QLabel *currentHighestBidLabel;
     QLabel *statusLabel;
+    QLabel *endTimeLabel = nullptr;
 
     QTableWidget *bidsTable;
     QPushButton *addBidBtn;
     QPushButton *completeAuctionBtn;
     QComboBox *clientCombo;
     QDoubleSpinBox *bidAmountSpin;
+    QCheckBox *proxyBidCheck;
 
     QDialogButtonBox *buttonBox;
     QStringList propertyIds;
@@ -4,6 +4,7 @@
 #include "../core/EstateAgency.h"
 #include <QLabel>
 #include <QPushButton>
+#include <QTableWidget>
 #include <QVBoxLayout>
 #include <QWidget>
 
@@ -22,6 +23,7 @@ class DashboardWidget : public QWidget
 
   private:
     void setupUI();
+    void updateCityStats();
 
     EstateAgency *agency;
     QLabel *statsPropertiesLabel;
@@ -29,6 +31,7 @@ class DashboardWidget : public QWidget
     QLabel *statsTransactionsLabel;
     QLabel *statsAvailableLabel;
     QLabel *statsAuctionsLabel;
+    QTableWidget *cityStatsTable;
     QPushButton *saveBtn;
     QPushButton *loadBtn;
     QPushButton *refreshBtn;
@@ -0,0 +1,49 @@
+#ifndef DIAGNOSTICSWIDGET_H
+#define DIAGNOSTICSWIDGET_H
+
+#include "../core/EstateAgency.h"
+#include "../core/Metrics.h"
+#include <QElapsedTimer>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <QWidget>
+#include <map>
+#include <string>
+
+class DiagnosticsWidget : public QWidget
+{
+    Q_OBJECT
+
+  public:
+    explicit DiagnosticsWidget(EstateAgency *agency, QWidget *parent = nullptr);
+    void refresh();
+
+  private slots:
+    void onTimerTick();
+    void resetMetrics();
+    void exportMetrics();
+
+  private:
+    void setupUI();
+    void addMetricRow(const MetricSnapshot &metric, double elapsedSeconds);
+    void addHitRateRow(const std::string &name, int64_t hits, int64_t misses);
+    void updateMemoryTable();
+    void addMemoryRow(const QString &title, const MemoryUsage &usage);
+
+    EstateAgency *agency;
+    QTableWidget *metricsTable;
+    QTableWidget *memoryTable;
+    QLabel *heapLabel;
+    QLabel *dumpPathLabel;
+    QPushButton *refreshBtn;
+    QPushButton *resetBtn;
+    QPushButton *exportBtn;
+    QTimer *refreshTimer;
+    QElapsedTimer sinceLastRefresh;
+    std::map<std::string, uint64_t, std::less<>> previousTotals;
+};
+
+#endif
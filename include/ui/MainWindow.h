@@ -6,16 +6,20 @@
 #include "../services/ClientManager.h"
 #include "../services/FileManager.h"
 #include "../services/PropertyManager.h"
+#include "../services/ReportGenerator.h"
 #include "../services/TransactionManager.h"
 #include "AuctionsWidget.h"
 #include "ClientsWidget.h"
 #include "DashboardWidget.h"
+#include "DiagnosticsWidget.h"
 #include "PropertiesWidget.h"
 #include "TransactionsWidget.h"
 #include <QListWidget>
 #include <QMainWindow>
 #include <QStackedWidget>
+#include <QTimer>
 #include <filesystem>
+#include <functional>
 #include <stdexcept>
 
 class MainWindow : public QMainWindow
@@ -32,6 +36,15 @@ class MainWindow : public QMainWindow
     void refreshAllData();
     void onNavigationChanged(int index);
     void onDataChanged();
+    void checkAuctionDeadlines();
+    void toggleTracing(bool enabled);
+    void exportTrace();
+    void findDuplicateClients();
+    void exportSalesReport();
+    void exportSalesByMonthReport();
+    void exportSalesByYearReport();
+    void exportSalesByStatusReport();
+    void exportAuctionOutcomesReport();
 
   private:
     void setupUI();
@@ -41,6 +54,9 @@ class MainWindow : public QMainWindow
     void updateDashboardStats();
     void showStatusMessage(const QString &message, int timeout = 3000) const;
     void handleException(const std::exception &e);
+    void exportReport(const QString &defaultName,
+                      const std::function<ReportSummary(const ReportGenerator &, const std::string &, ReportFormat)>
+                          &write);
 
     template <typename Func> void executeWithExceptionHandling(Func &&operation)
     {
@@ -104,6 +120,9 @@ class MainWindow : public QMainWindow
     ClientsWidget *clientsWidget;
     TransactionsWidget *transactionsWidget;
     AuctionsWidget *auctionsWidget;
+    DiagnosticsWidget *diagnosticsWidget;
+
+    QTimer *auctionDeadlineTimer = nullptr;
 };
 
 #endif
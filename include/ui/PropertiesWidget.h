@@ -3,8 +3,11 @@
 
 #include "../core/EstateAgency.h"
 #include "../entities/Property.h"
+#include <QCheckBox>
+#include <QComboBox>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QSpinBox>
 #include <QSplitter>
 #include <QTableWidget>
 #include <QTextEdit>
@@ -28,6 +31,7 @@ class PropertiesWidget : public QWidget
     void editProperty();
     void deleteProperty();
     void searchProperties();
+    void applyFilters();
     void propertySelectionChanged();
     void showHelp();
 
@@ -47,6 +51,13 @@ class PropertiesWidget : public QWidget
     QPushButton *refreshPropertyBtn;
     QPushButton *searchPropertyBtn;
     QLineEdit *searchPropertyEdit;
+    QComboBox *filterTypeCombo;
+    QSpinBox *minPriceSpin;
+    QSpinBox *maxPriceSpin;
+    QSpinBox *minRoomsSpin;
+    QCheckBox *availableOnlyCheck;
+    QComboBox *sortCombo;
+    QPushButton *applyFilterBtn;
     QTextEdit *propertyDetailsText;
 };
 
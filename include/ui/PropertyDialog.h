@@ -34,7 +34,7 @@ class PropertyDialog : public QDialog
     QString getCity() const;
     QString getStreet() const;
     QString getHouse() const;
-    double getPrice() const;
+    Money getPrice() const;
     double getArea() const;
     QString getDescription() const;
     bool getIsAvailable() const;
@@ -24,7 +24,7 @@ class TransactionDialog : public QDialog
     QString getId() const;
     QString getPropertyId() const;
     QString getClientId() const;
-    double getFinalPrice() const;
+    Money getFinalPrice() const;
     QString getStatus() const;
     QString getNotes() const;
 
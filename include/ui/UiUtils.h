@@ -0,0 +1,33 @@
+#ifndef UI_UTILS_H
+#define UI_UTILS_H
+
+#include "../core/Utils.h"
+#include <QString>
+#include <algorithm>
+
+namespace Utils
+{
+
+inline std::string toString(const QString &qstr) { return qstr.toStdString(); }
+
+inline QString toQString(const std::string &str) { return QString::fromStdString(str); }
+
+inline std::string safeToString(const QString &qstr) { return qstr.isEmpty() ? std::string() : qstr.toStdString(); }
+
+inline QString formatPrice(const Money &price) { return QString::fromStdString(price.toString()) + " руб."; }
+
+inline QString formatNumber(double number, int decimals = 2) { return QString::number(number, 'f', decimals); }
+
+inline QString formatNumber(const Money &amount) { return QString::fromStdString(amount.toString()); }
+
+inline bool isNumericId(const QString &str)
+{
+    if (str.length() < 6 || str.length() > 8)
+    {
+        return false;
+    }
+    return std::ranges::all_of(str, [](const QChar &ch) { return ch.isDigit(); });
+}
+} 
+
+#endif
@@ -0,0 +1,56 @@
+#include "../../include/core/Aggregation.h"
+#include <algorithm>
+#include <cmath>
+
+void AggregateStats::add(Money value)
+{
+    if (valueCount == 0)
+    {
+        minValue = value;
+        maxValue = value;
+    }
+    else
+    {
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+    }
+    ++count;
+    ++valueCount;
+    total += value;
+    sketch.add(static_cast<double>(value.getKopecks()));
+}
+
+void AggregateStats::merge(const AggregateStats &other)
+{
+    if (other.valueCount > 0)
+    {
+        if (valueCount == 0)
+        {
+            minValue = other.minValue;
+            maxValue = other.maxValue;
+        }
+        else
+        {
+            minValue = std::min(minValue, other.minValue);
+            maxValue = std::max(maxValue, other.maxValue);
+        }
+    }
+    count += other.count;
+    valueCount += other.valueCount;
+    total += other.total;
+    sketch.merge(other.sketch);
+}
+
+Money AggregateStats::getAverage() const
+{
+    return valueCount > 0 ? total.scaled(1, static_cast<int64_t>(valueCount)) : Money();
+}
+
+Money AggregateStats::getPercentile(double q) const
+{
+    if (valueCount == 0)
+    {
+        return Money();
+    }
+    return Money::fromKopecks(static_cast<int64_t>(std::llround(sketch.quantile(q))));
+}
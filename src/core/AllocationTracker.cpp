@@ -0,0 +1,105 @@
+#include "../../include/core/AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(ESTATE_TRACK_ALLOCATIONS) && defined(__GLIBC__)
+#include <malloc.h>
+#define ESTATE_ALLOCATION_HOOKS 1
+#endif
+
+namespace
+{
+std::atomic<size_t> liveBytes{0};
+std::atomic<size_t> liveAllocations{0};
+std::atomic<size_t> totalAllocations{0};
+std::atomic<size_t> peakBytes{0};
+
+#ifdef ESTATE_ALLOCATION_HOOKS
+void *trackedAllocate(size_t size) noexcept
+{
+    void *pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr)
+    {
+        return nullptr;
+    }
+
+    size_t usable = malloc_usable_size(pointer);
+    size_t current = liveBytes.fetch_add(usable, std::memory_order_relaxed) + usable;
+    liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    size_t peak = peakBytes.load(std::memory_order_relaxed);
+    while (current > peak && !peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+    return pointer;
+}
+
+void trackedRelease(void *pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+    liveBytes.fetch_sub(malloc_usable_size(pointer), std::memory_order_relaxed);
+    liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    std::free(pointer);
+}
+#endif
+}
+
+bool AllocationTracker::isEnabled()
+{
+#ifdef ESTATE_ALLOCATION_HOOKS
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocationStats AllocationTracker::getStats()
+{
+    AllocationStats stats;
+    stats.liveBytes = liveBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = liveAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = totalAllocations.load(std::memory_order_relaxed);
+    stats.peakBytes = peakBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+#ifdef ESTATE_ALLOCATION_HOOKS
+void *operator new(size_t size)
+{
+    if (void *pointer = trackedAllocate(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    if (void *pointer = trackedAllocate(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return trackedAllocate(size); }
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return trackedAllocate(size); }
+
+void operator delete(void *pointer) noexcept { trackedRelease(pointer); }
+
+void operator delete[](void *pointer) noexcept { trackedRelease(pointer); }
+
+void operator delete(void *pointer, size_t) noexcept { trackedRelease(pointer); }
+
+void operator delete[](void *pointer, size_t) noexcept { trackedRelease(pointer); }
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept { trackedRelease(pointer); }
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept { trackedRelease(pointer); }
+#endif
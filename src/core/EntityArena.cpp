@@ -0,0 +1,49 @@
+#include "../../include/core/EntityArena.h"
+#include <new>
+
+EntityArena::~EntityArena()
+{
+    for (const auto &slab : slabs)
+    {
+        ::operator delete(slab.data, slab.size);
+    }
+}
+
+std::byte *EntityArena::allocateSlab(size_t size)
+{
+    auto *data = static_cast<std::byte *>(::operator new(size));
+    slabs.push_back({data, size});
+    reservedBytes.fetch_add(size, std::memory_order_relaxed);
+    return data;
+}
+
+void *EntityArena::do_allocate(size_t bytes, size_t alignment)
+{
+    std::scoped_lock lock(slabMutex);
+    usedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    if (alignment > ArenaDeleter::ALIGNMENT || bytes >= LARGE_BLOCK_BYTES)
+    {
+        size_t size = bytes + alignment;
+        void *data = allocateSlab(size);
+        return std::align(alignment, bytes, data, size);
+    }
+
+    auto address = reinterpret_cast<uintptr_t>(cursor);
+    auto *aligned = cursor + ((alignment - address % alignment) % alignment);
+    if (cursor == nullptr || aligned + bytes > limit)
+    {
+        cursor = allocateSlab(SLAB_BYTES);
+        limit = cursor + SLAB_BYTES;
+        aligned = cursor;
+    }
+    cursor = aligned + bytes;
+    return aligned;
+}
+
+void EntityArena::do_deallocate(void *, size_t bytes, size_t)
+{
+    usedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool EntityArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept { return this == &other; }
@@ -1,4 +1,6 @@
 #include "../../include/core/EstateAgency.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/services/FileManager.h"
 #include <filesystem>
 
@@ -8,12 +10,16 @@ constexpr const char *PROPERTIES_FILE = "properties.txt";
 constexpr const char *CLIENTS_FILE = "clients.txt";
 constexpr const char *TRANSACTIONS_FILE = "transactions.txt";
 constexpr const char *AUCTIONS_FILE = "auctions.txt";
+constexpr const char *PRICE_HISTORY_FILE = "price_history.txt";
+constexpr const char *SEARCH_PROFILES_FILE = "search_profiles.txt";
 } 
 
 EstateAgency *EstateAgency::instance = nullptr;
 
 EstateAgency::EstateAgency()
 {
+    propertyManager.setChangeCallback([this](const Property &property)
+                                      { clientMatcher.notifyPropertyChanged(property); });
     try
     {
         std::filesystem::create_directories(dataDirectory);
@@ -47,12 +53,16 @@ void EstateAgency::destroyInstance()
 
 void EstateAgency::saveAllData() const
 {
+    TRACE_SCOPE("EstateAgency::saveAllData");
+    METRIC_TIME_SCOPE("agency.save_all.duration_ns");
     try
     {
         FileManager::saveProperties(propertyManager, dataDirectory + "/" + PROPERTIES_FILE);
         FileManager::saveClients(clientManager, dataDirectory + "/" + CLIENTS_FILE);
         FileManager::saveTransactions(transactionManager, dataDirectory + "/" + TRANSACTIONS_FILE);
         FileManager::saveAuctions(auctionManager, dataDirectory + "/" + AUCTIONS_FILE);
+        FileManager::savePriceHistory(propertyManager, dataDirectory + "/" + PRICE_HISTORY_FILE);
+        FileManager::saveSearchProfiles(clientMatcher, dataDirectory + "/" + SEARCH_PROFILES_FILE);
     }
     catch (const FileManagerException &e)
     {
@@ -66,12 +76,17 @@ void EstateAgency::saveAllData() const
 
 void EstateAgency::loadAllData()
 {
+    TRACE_SCOPE("EstateAgency::loadAllData");
+    METRIC_TIME_SCOPE("agency.load_all.duration_ns");
     try
     {
         FileManager::loadProperties(propertyManager, dataDirectory + "/" + PROPERTIES_FILE);
         FileManager::loadClients(clientManager, dataDirectory + "/" + CLIENTS_FILE);
         FileManager::loadTransactions(transactionManager, dataDirectory + "/" + TRANSACTIONS_FILE);
         FileManager::loadAuctions(auctionManager, dataDirectory + "/" + AUCTIONS_FILE);
+        FileManager::loadPriceHistory(propertyManager, dataDirectory + "/" + PRICE_HISTORY_FILE);
+        FileManager::loadSearchProfiles(clientMatcher, dataDirectory + "/" + SEARCH_PROFILES_FILE);
+        auctionScheduler.rescheduleAll();
     }
     catch (const FileManagerException &e)
     {
@@ -82,3 +97,41 @@ void EstateAgency::loadAllData()
         (void)e;
     }
 }
+
+void EstateAgency::publishMetrics() const
+{
+    MetricsRegistry &registry = MetricsRegistry::instance();
+    registry.gauge("property.count").set(static_cast<int64_t>(propertyManager.getCount()));
+    registry.gauge("client.count").set(static_cast<int64_t>(clientManager.getCount()));
+    registry.gauge("transaction.count").set(static_cast<int64_t>(transactionManager.getCount()));
+    registry.gauge("auction.count").set(static_cast<int64_t>(auctionManager.getCount()));
+
+    MemoryReport report = getMemoryReport();
+    registry.gauge("memory.property.bytes").set(static_cast<int64_t>(report.properties.getTotalBytes()));
+    registry.gauge("memory.client.bytes").set(static_cast<int64_t>(report.clients.getTotalBytes()));
+    registry.gauge("memory.transaction.bytes").set(static_cast<int64_t>(report.transactions.getTotalBytes()));
+    registry.gauge("memory.auction.bytes").set(static_cast<int64_t>(report.auctions.getTotalBytes()));
+    registry.gauge("memory.symbols.bytes").set(static_cast<int64_t>(report.symbols.getTotalBytes()));
+    registry.gauge("memory.symbols.count").set(static_cast<int64_t>(report.symbols.objectCount));
+    registry.gauge("memory.arena.reserved_bytes").set(static_cast<int64_t>(report.getTotal().arenaBytes));
+    if (report.heapTracked)
+    {
+        registry.gauge("memory.heap.live_bytes").set(static_cast<int64_t>(report.heap.liveBytes));
+        registry.gauge("memory.heap.peak_bytes").set(static_cast<int64_t>(report.heap.peakBytes));
+        registry.gauge("memory.heap.live_allocations").set(static_cast<int64_t>(report.heap.liveAllocations));
+    }
+}
+
+MemoryReport EstateAgency::getMemoryReport() const
+{
+    MemoryReport report;
+    report.properties = propertyManager.getMemoryUsage();
+    report.clients = clientManager.getMemoryUsage();
+    report.clients += clientMatcher.getMemoryUsage();
+    report.transactions = transactionManager.getMemoryUsage();
+    report.auctions = auctionManager.getMemoryUsage();
+    report.symbols = StringPool::instance().getMemoryUsage();
+    report.heapTracked = AllocationTracker::isEnabled();
+    report.heap = AllocationTracker::getStats();
+    return report;
+}
@@ -0,0 +1,276 @@
+#include "../../include/core/Metrics.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+constexpr const char *METRIC_PREFIX = "estate_";
+constexpr double MEDIAN = 0.5;
+constexpr double P99 = 0.99;
+constexpr double P999 = 0.999;
+
+std::string exportName(const std::string &name)
+{
+    std::string result = METRIC_PREFIX;
+    result.reserve(result.size() + name.size());
+    for (char c : name)
+    {
+        bool allowed = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        result += allowed ? c : '_';
+    }
+    return result;
+}
+} 
+
+size_t Histogram::bucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return static_cast<size_t>(value);
+    }
+    auto magnitude = static_cast<unsigned>(std::bit_width(value) - 1);
+    unsigned shift = magnitude - SUB_BUCKET_BITS;
+    auto mantissa = static_cast<size_t>(value >> shift) - SUB_BUCKET_COUNT;
+    return (shift + 1) * SUB_BUCKET_COUNT + mantissa;
+}
+
+uint64_t Histogram::bucketLowerBound(size_t index)
+{
+    size_t group = index / SUB_BUCKET_COUNT;
+    size_t offset = index % SUB_BUCKET_COUNT;
+    if (group == 0)
+    {
+        return offset;
+    }
+    return static_cast<uint64_t>(SUB_BUCKET_COUNT + offset) << (group - 1);
+}
+
+uint64_t Histogram::bucketUpperBound(size_t index)
+{
+    size_t group = index / SUB_BUCKET_COUNT;
+    if (group == 0)
+    {
+        return bucketLowerBound(index);
+    }
+    return bucketLowerBound(index) + ((uint64_t{1} << (group - 1)) - 1);
+}
+
+void Histogram::record(uint64_t value)
+{
+    buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void Histogram::reset()
+{
+    for (auto &bucket : buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::percentile(double quantile) const
+{
+    uint64_t total = 0;
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        counts[i] = buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(total)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            return std::min(bucketUpperBound(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+MetricsRegistry &MetricsRegistry::instance()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+int64_t MetricsRegistry::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+Counter &MetricsRegistry::counter(const std::string &name)
+{
+    std::scoped_lock lock(mutex);
+    auto &slot = counters[name];
+    if (!slot)
+    {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+Gauge &MetricsRegistry::gauge(const std::string &name)
+{
+    std::scoped_lock lock(mutex);
+    auto &slot = gauges[name];
+    if (!slot)
+    {
+        slot = std::make_unique<Gauge>();
+    }
+    return *slot;
+}
+
+Histogram &MetricsRegistry::histogram(const std::string &name)
+{
+    std::scoped_lock lock(mutex);
+    auto &slot = histograms[name];
+    if (!slot)
+    {
+        slot = std::make_unique<Histogram>();
+    }
+    return *slot;
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::snapshot() const
+{
+    std::scoped_lock lock(mutex);
+    std::vector<MetricSnapshot> result;
+    result.reserve(counters.size() + gauges.size() + histograms.size());
+
+    for (const auto &[name, counter] : counters)
+    {
+        MetricSnapshot entry;
+        entry.name = name;
+        entry.type = MetricType::Counter;
+        entry.value = static_cast<int64_t>(counter->get());
+        result.push_back(std::move(entry));
+    }
+    for (const auto &[name, gauge] : gauges)
+    {
+        MetricSnapshot entry;
+        entry.name = name;
+        entry.type = MetricType::Gauge;
+        entry.value = gauge->get();
+        result.push_back(std::move(entry));
+    }
+    for (const auto &[name, histogram] : histograms)
+    {
+        MetricSnapshot entry;
+        entry.name = name;
+        entry.type = MetricType::Histogram;
+        entry.count = histogram->getCount();
+        entry.sum = histogram->getSum();
+        entry.p50 = histogram->percentile(MEDIAN);
+        entry.p99 = histogram->percentile(P99);
+        entry.p999 = histogram->percentile(P999);
+        entry.max = histogram->getMax();
+        result.push_back(std::move(entry));
+    }
+
+    std::ranges::sort(result, {}, &MetricSnapshot::name);
+    return result;
+}
+
+std::string MetricsRegistry::formatText() const
+{
+    std::ostringstream out;
+    for (const auto &metric : snapshot())
+    {
+        std::string name = exportName(metric.name);
+        switch (metric.type)
+        {
+        case MetricType::Counter:
+            out << "# TYPE " << name << "_total counter\n" << name << "_total " << metric.value << "\n";
+            break;
+        case MetricType::Gauge:
+            out << "# TYPE " << name << " gauge\n" << name << " " << metric.value << "\n";
+            break;
+        case MetricType::Histogram:
+            out << "# TYPE " << name << " summary\n"
+                << name << "{quantile=\"0.5\"} " << metric.p50 << "\n"
+                << name << "{quantile=\"0.99\"} " << metric.p99 << "\n"
+                << name << "{quantile=\"0.999\"} " << metric.p999 << "\n"
+                << name << "_max " << metric.max << "\n"
+                << name << "_sum " << metric.sum << "\n"
+                << name << "_count " << metric.count << "\n";
+            break;
+        }
+    }
+    return out.str();
+}
+
+void MetricsRegistry::dumpToFile(const std::string &filename) const
+{
+    std::string temporary = filename + ".tmp";
+    {
+        std::ofstream file(temporary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Cannot open file for writing: " + temporary);
+        }
+        file << formatText();
+    }
+    std::filesystem::rename(temporary, filename);
+}
+
+void MetricsRegistry::reset()
+{
+    std::scoped_lock lock(mutex);
+    for (const auto &[name, counter] : counters)
+    {
+        counter->reset();
+    }
+    for (const auto &[name, histogram] : histograms)
+    {
+        histogram->reset();
+    }
+}
+
+void MetricsRegistry::configureFromEnvironment()
+{
+    const char *value = std::getenv(ENVIRONMENT_VARIABLE);
+    setDumpPath(value != nullptr ? value : "");
+}
+
+void MetricsRegistry::setDumpPath(const std::string &path)
+{
+    std::scoped_lock lock(mutex);
+    dumpPath = path;
+}
+
+std::string MetricsRegistry::getDumpPath() const
+{
+    std::scoped_lock lock(mutex);
+    return dumpPath;
+}
+
+ScopedTimer::ScopedTimer(Histogram &target) : histogram(target), startNs(MetricsRegistry::nowNs()) {}
+
+ScopedTimer::~ScopedTimer() { histogram.record(static_cast<uint64_t>(MetricsRegistry::nowNs() - startNs)); }
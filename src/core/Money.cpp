@@ -0,0 +1,133 @@
+#include "../../include/core/Money.h"
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+namespace
+{
+constexpr int FRACTION_DIGITS = 2;
+constexpr size_t MAX_RUBLE_TEXT_LENGTH = 20;
+
+constexpr double KOPECKS_LIMIT = -static_cast<double>(std::numeric_limits<int64_t>::min());
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool fitsKopecks(double kopecks) { return kopecks >= -KOPECKS_LIMIT && kopecks < KOPECKS_LIMIT; }
+
+std::optional<Money> parseFallback(std::string_view text)
+{
+    double value = 0.0;
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc() || ptr != text.data() + text.size() || !fitsKopecks(value * Money::KOPECKS_PER_RUBLE))
+    {
+        return std::nullopt;
+    }
+    return Money::fromDouble(value);
+}
+} 
+
+Money Money::fromDouble(double rubles)
+{
+    double kopecks = rubles * KOPECKS_PER_RUBLE;
+    if (!fitsKopecks(kopecks))
+    {
+        throw std::invalid_argument("Invalid amount: must be a finite value within the Money range");
+    }
+    return Money(std::llround(kopecks));
+}
+
+std::optional<Money> Money::parse(std::string_view text)
+{
+    while (!text.empty() && text.front() == ' ')
+    {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\r'))
+    {
+        text.remove_suffix(1);
+    }
+    if (text.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::string_view digits = text;
+    bool negative = false;
+    if (digits.front() == '-' || digits.front() == '+')
+    {
+        negative = digits.front() == '-';
+        digits.remove_prefix(1);
+    }
+
+    int64_t rubles = 0;
+    size_t pos = 0;
+    constexpr size_t MAX_RUBLE_DIGITS = 16;
+    while (pos < digits.size() && isDigit(digits[pos]))
+    {
+        if (pos == MAX_RUBLE_DIGITS)
+        {
+            return std::nullopt;
+        }
+        rubles = rubles * 10 + (digits[pos] - '0');
+        ++pos;
+    }
+    if (pos == 0)
+    {
+        return parseFallback(text);
+    }
+
+    int64_t fraction = 0;
+    if (pos < digits.size() && (digits[pos] == '.' || digits[pos] == ','))
+    {
+        ++pos;
+        int fractionDigits = 0;
+        while (pos < digits.size() && isDigit(digits[pos]) && fractionDigits < FRACTION_DIGITS)
+        {
+            fraction = fraction * 10 + (digits[pos] - '0');
+            ++fractionDigits;
+            ++pos;
+        }
+        if (fractionDigits == 1)
+        {
+            fraction *= 10;
+        }
+        if (pos < digits.size() && isDigit(digits[pos]))
+        {
+            return parseFallback(text);
+        }
+    }
+
+    if (pos != digits.size())
+    {
+        return parseFallback(text);
+    }
+
+    int64_t total = rubles * KOPECKS_PER_RUBLE + fraction;
+    return Money(negative ? -total : total);
+}
+
+char *Money::formatTo(char *out) const
+{
+    uint64_t magnitude = kopecks < 0 ? 0 - static_cast<uint64_t>(kopecks) : static_cast<uint64_t>(kopecks);
+    if (kopecks < 0)
+    {
+        *out++ = '-';
+    }
+
+    auto [end, ec] = std::to_chars(out, out + MAX_RUBLE_TEXT_LENGTH, magnitude / KOPECKS_PER_RUBLE);
+    (void)ec;
+    uint64_t fraction = magnitude % KOPECKS_PER_RUBLE;
+    *end++ = '.';
+    *end++ = static_cast<char>('0' + fraction / 10);
+    *end++ = static_cast<char>('0' + fraction % 10);
+    return end;
+}
+
+std::string Money::toString() const
+{
+    char buffer[MAX_TEXT_LENGTH];
+    char *end = formatTo(buffer);
+    return std::string(buffer, end);
+}
@@ -0,0 +1,176 @@
+#include "../../include/core/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+constexpr double BUFFER_FACTOR = 5.0;
+
+double scale(double q, double compression)
+{
+    return compression / (2.0 * std::numbers::pi) * std::asin(2.0 * q - 1.0);
+}
+
+double scaleInverse(double k, double compression)
+{
+    return (std::sin(k * 2.0 * std::numbers::pi / compression) + 1.0) / 2.0;
+}
+} 
+
+QuantileSketch::QuantileSketch(double compression) : compression(compression) {}
+
+std::vector<QuantileSketch::Centroid> QuantileSketch::compress(std::vector<Centroid> input, double compression)
+{
+    std::vector<Centroid> merged;
+    if (input.empty())
+    {
+        return merged;
+    }
+    std::ranges::sort(input, {}, &Centroid::mean);
+
+    double total = 0.0;
+    for (const auto &centroid : input)
+    {
+        total += centroid.weight;
+    }
+
+    merged.reserve(static_cast<size_t>(compression));
+    Centroid current = input.front();
+    double weightBefore = 0.0;
+    double limit = scaleInverse(scale(0.0, compression) + 1.0, compression);
+    for (size_t i = 1; i < input.size(); ++i)
+    {
+        double proposed = current.weight + input[i].weight;
+        if ((weightBefore + proposed) / total <= limit)
+        {
+            current.mean += (input[i].mean - current.mean) * input[i].weight / proposed;
+            current.weight = proposed;
+        }
+        else
+        {
+            weightBefore += current.weight;
+            merged.push_back(current);
+            current = input[i];
+            limit = scaleInverse(scale(weightBefore / total, compression) + 1.0, compression);
+        }
+    }
+    merged.push_back(current);
+    return merged;
+}
+
+void QuantileSketch::flush()
+{
+    if (buffer.empty())
+    {
+        return;
+    }
+    buffer.insert(buffer.end(), centroids.begin(), centroids.end());
+    centroids = compress(std::move(buffer), compression);
+    buffer.clear();
+}
+
+void QuantileSketch::add(double value, double weight)
+{
+    if (weight <= 0.0 || std::isnan(value))
+    {
+        return;
+    }
+    if (empty())
+    {
+        minValue = value;
+        maxValue = value;
+    }
+    else
+    {
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+    }
+    totalWeight += weight;
+    buffer.push_back({value, weight});
+    if (static_cast<double>(buffer.size()) >= compression * BUFFER_FACTOR)
+    {
+        flush();
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+    if (other.empty())
+    {
+        return;
+    }
+    if (empty())
+    {
+        minValue = other.minValue;
+        maxValue = other.maxValue;
+    }
+    else
+    {
+        minValue = std::min(minValue, other.minValue);
+        maxValue = std::max(maxValue, other.maxValue);
+    }
+    totalWeight += other.totalWeight;
+    buffer.insert(buffer.end(), other.centroids.begin(), other.centroids.end());
+    buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+    flush();
+}
+
+void QuantileSketch::clear()
+{
+    centroids.clear();
+    buffer.clear();
+    totalWeight = 0.0;
+    minValue = 0.0;
+    maxValue = 0.0;
+}
+
+double QuantileSketch::quantile(double q) const
+{
+    if (empty())
+    {
+        return 0.0;
+    }
+    if (q <= 0.0)
+    {
+        return minValue;
+    }
+    if (q >= 1.0)
+    {
+        return maxValue;
+    }
+
+    std::vector<Centroid> all = centroids;
+    if (!buffer.empty())
+    {
+        all.insert(all.end(), buffer.begin(), buffer.end());
+        all = compress(std::move(all), compression);
+    }
+
+    double target = q * totalWeight;
+    double cumulative = 0.0;
+    double previousMean = minValue;
+    double previousCenter = 0.0;
+    for (const auto &centroid : all)
+    {
+        double center = cumulative + centroid.weight / 2.0;
+        if (target < center)
+        {
+            double span = center - previousCenter;
+            double fraction = span > 0.0 ? (target - previousCenter) / span : 0.0;
+            return previousMean + fraction * (centroid.mean - previousMean);
+        }
+        cumulative += centroid.weight;
+        previousMean = centroid.mean;
+        previousCenter = center;
+    }
+
+    double span = totalWeight - previousCenter;
+    double fraction = span > 0.0 ? (target - previousCenter) / span : 0.0;
+    return previousMean + fraction * (maxValue - previousMean);
+}
+
+size_t QuantileSketch::getMemoryBytes() const
+{
+    return (centroids.capacity() + buffer.capacity()) * sizeof(Centroid);
+}
@@ -0,0 +1,100 @@
+#include "../../include/core/StringPool.h"
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <ranges>
+
+namespace
+{
+constexpr int8_t VERDICT_UNKNOWN = -1;
+constexpr int8_t VERDICT_MISMATCH = 0;
+constexpr int8_t VERDICT_MATCH = 1;
+constexpr size_t HASH_NODE_BYTES = sizeof(void *) + sizeof(std::string_view) + sizeof(Symbol) + sizeof(size_t);
+} 
+
+StringPool::StringPool() { intern(""); }
+
+StringPool &StringPool::instance()
+{
+    static StringPool pool;
+    return pool;
+}
+
+Symbol StringPool::intern(std::string_view value)
+{
+    {
+        std::shared_lock lock(mutex);
+        if (auto it = symbols.find(value); it != symbols.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(mutex);
+    if (auto it = symbols.find(value); it != symbols.end())
+    {
+        return it->second;
+    }
+    auto symbol = static_cast<Symbol>(strings.size());
+    const std::string &stored = strings.emplace_back(value);
+    symbols.try_emplace(stored, symbol);
+    return symbol;
+}
+
+std::optional<Symbol> StringPool::find(std::string_view value) const
+{
+    std::shared_lock lock(mutex);
+    if (auto it = symbols.find(value); it != symbols.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::string_view StringPool::resolve(Symbol symbol) const
+{
+    std::shared_lock lock(mutex);
+    auto index = static_cast<size_t>(symbol);
+    return index < strings.size() ? std::string_view(strings[index]) : std::string_view();
+}
+
+size_t StringPool::size() const
+{
+    std::shared_lock lock(mutex);
+    return strings.size();
+}
+
+MemoryUsage StringPool::getMemoryUsage() const
+{
+    std::shared_lock lock(mutex);
+    MemoryUsage usage;
+    usage.objectCount = strings.size();
+    usage.objectBytes = strings.size() * sizeof(std::string);
+    usage.indexBytes = symbols.bucket_count() * sizeof(void *) + symbols.size() * HASH_NODE_BYTES;
+    for (const auto &value : strings)
+    {
+        usage.stringBytes += Memory::stringHeapBytes(value);
+    }
+    return usage;
+}
+
+SymbolMatcher::SymbolMatcher(std::string_view pattern) : needle(pattern)
+{
+    std::ranges::transform(needle, needle.begin(), [](unsigned char c) { return std::tolower(c); });
+}
+
+bool SymbolMatcher::matches(Symbol symbol)
+{
+    auto index = static_cast<size_t>(symbol);
+    if (index >= verdicts.size())
+    {
+        verdicts.resize(index + 1, VERDICT_UNKNOWN);
+    }
+    if (verdicts[index] == VERDICT_UNKNOWN)
+    {
+        std::string text(StringPool::instance().resolve(symbol));
+        std::ranges::transform(text, text.begin(), [](unsigned char c) { return std::tolower(c); });
+        verdicts[index] = text.contains(needle) ? VERDICT_MATCH : VERDICT_MISMATCH;
+    }
+    return verdicts[index] == VERDICT_MATCH;
+}
@@ -0,0 +1,232 @@
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Metrics.h"
+#include <charconv>
+#include <cstdlib>
+#include <exception>
+#include <string_view>
+
+namespace
+{
+constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+
+thread_local size_t currentWorker = NO_WORKER;
+
+size_t configuredWorkerCount()
+{
+    size_t count = std::thread::hardware_concurrency();
+    if (const char *value = std::getenv(ThreadPool::ENVIRONMENT_VARIABLE); value != nullptr)
+    {
+        std::string_view text(value);
+        size_t requested = 0;
+        if (auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), requested);
+            error == std::errc() && end == text.data() + text.size())
+        {
+            count = requested;
+        }
+    }
+    return count;
+}
+
+struct Batch
+{
+    std::atomic<size_t> remaining;
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+
+    explicit Batch(size_t tasks) : remaining(tasks) {}
+
+    void run(const std::function<void(size_t)> &task, size_t index)
+    {
+        try
+        {
+            task(index);
+        }
+        catch (...)
+        {
+            std::scoped_lock lock(mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+        std::scoped_lock lock(mutex);
+        if (--remaining == 0)
+        {
+            done.notify_all();
+        }
+    }
+};
+} 
+
+ThreadPool::ThreadPool(size_t workerCount)
+{
+    if (workerCount < 2)
+    {
+        return;
+    }
+
+    queues.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(sleepMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+ThreadPool &ThreadPool::instance()
+{
+    static ThreadPool pool(configuredWorkerCount());
+    return pool;
+}
+
+size_t ThreadPool::getChunkCount(size_t rows) const
+{
+    if (rows < PARALLEL_THRESHOLD || workers.size() < 2)
+    {
+        return 1;
+    }
+    return std::min((rows + MIN_CHUNK_ROWS - 1) / MIN_CHUNK_ROWS, workers.size() * CHUNKS_PER_WORKER);
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    size_t index = currentWorker < queues.size() ? currentWorker
+                                                 : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::scoped_lock lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::scoped_lock lock(sleepMutex);
+        queuedTasks.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeCondition.notify_one();
+}
+
+bool ThreadPool::runPending(size_t preferredQueue)
+{
+    static Counter &executed = MetricsRegistry::instance().counter("threadpool.tasks");
+    static Counter &stolen = MetricsRegistry::instance().counter("threadpool.steals");
+
+    std::function<void()> task;
+    if (preferredQueue < queues.size())
+    {
+        std::scoped_lock lock(queues[preferredQueue]->mutex);
+        if (auto &own = queues[preferredQueue]->tasks; !own.empty())
+        {
+            task = std::move(own.back());
+            own.pop_back();
+        }
+    }
+    for (size_t offset = 1; !task && offset <= queues.size(); ++offset)
+    {
+        size_t victim = (preferredQueue + offset) % queues.size();
+        std::scoped_lock lock(queues[victim]->mutex);
+        if (auto &other = queues[victim]->tasks; !other.empty())
+        {
+            task = std::move(other.front());
+            other.pop_front();
+            stolen.increment();
+        }
+    }
+    if (!task)
+    {
+        return false;
+    }
+
+    queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    executed.increment();
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t index)
+{
+    currentWorker = index;
+    while (true)
+    {
+        if (runPending(index))
+        {
+            continue;
+        }
+        std::unique_lock lock(sleepMutex);
+        wakeCondition.wait(lock, [this]() { return stopping || queuedTasks.load(std::memory_order_relaxed) > 0; });
+        if (stopping && queuedTasks.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t taskCount, const std::function<void(size_t)> &task)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+    if (workers.empty() || taskCount == 1)
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>(taskCount);
+    for (size_t i = 1; i < taskCount; ++i)
+    {
+        submit([batch, &task, i]() { batch->run(task, i); });
+    }
+    batch->run(task, 0);
+
+    while (batch->remaining.load() > 0)
+    {
+        if (runPending(currentWorker))
+        {
+            continue;
+        }
+        if (queuedTasks.load(std::memory_order_relaxed) > 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock lock(batch->mutex);
+        batch->done.wait(lock, [&batch]() { return batch->remaining.load() == 0; });
+    }
+
+    if (batch->error)
+    {
+        std::rethrow_exception(batch->error);
+    }
+}
+
+void ThreadPool::parallelChunks(size_t rows, const std::function<void(size_t, size_t, size_t)> &scan)
+{
+    size_t chunks = getChunkCount(rows);
+    size_t chunkRows = (rows + chunks - 1) / chunks;
+    parallelFor(chunks,
+                [&](size_t chunk)
+                {
+                    size_t begin = std::min(rows, chunk * chunkRows);
+                    scan(chunk, begin, std::min(rows, begin + chunkRows));
+                });
+}
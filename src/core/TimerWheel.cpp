@@ -0,0 +1,144 @@
+#include "../../include/core/TimerWheel.h"
+#include <utility>
+
+namespace
+{
+constexpr int64_t SLOT_MASK = TimerWheel::SLOTS - 1;
+constexpr int64_t NOT_SCHEDULED = -1;
+
+int64_t levelShift(int level) { return static_cast<int64_t>(level) * TimerWheel::SLOT_BITS; }
+} 
+
+TimerWheel::TimerWheel(int64_t startTick) : currentTick(startTick) {}
+
+TimerWheel::TimerId TimerWheel::schedule(int64_t expiryTick, Callback callback)
+{
+    TimerId id = nextId++;
+    auto [it, inserted] = timers.emplace(id, Timer{expiryTick, 0, std::move(callback)});
+    place(id, it->second);
+    return id;
+}
+
+bool TimerWheel::reschedule(TimerId id, int64_t expiryTick)
+{
+    auto it = timers.find(id);
+    if (it == timers.end())
+    {
+        return false;
+    }
+    it->second.expiry = expiryTick;
+    ++it->second.version;
+    place(id, it->second);
+    return true;
+}
+
+bool TimerWheel::cancel(TimerId id) { return timers.erase(id) > 0; }
+
+int64_t TimerWheel::getExpiry(TimerId id) const
+{
+    auto it = timers.find(id);
+    return it != timers.end() ? it->second.expiry : NOT_SCHEDULED;
+}
+
+size_t TimerWheel::advance(int64_t nowTick)
+{
+    size_t fired = fireSlot(overdue);
+
+    while (currentTick < nowTick)
+    {
+        if (timers.empty())
+        {
+            currentTick = nowTick;
+            break;
+        }
+
+        ++currentTick;
+
+        int topLevel = 0;
+        while (topLevel + 1 < LEVELS && (currentTick & ((int64_t{1} << levelShift(topLevel + 1)) - 1)) == 0)
+        {
+            ++topLevel;
+        }
+        for (int level = topLevel; level >= 1; --level)
+        {
+            cascade(level);
+        }
+
+        fired += fireSlot(overdue);
+        fired += fireSlot(wheel[0][currentTick & SLOT_MASK]);
+    }
+    return fired;
+}
+
+void TimerWheel::place(TimerId id, const Timer &timer)
+{
+    int64_t delta = timer.expiry - currentTick;
+    if (delta <= 0)
+    {
+        overdue.push_back({id, timer.version});
+        return;
+    }
+
+    int level = 0;
+    while (level + 1 < LEVELS && (delta >> levelShift(level + 1)) != 0)
+    {
+        ++level;
+    }
+    int64_t slot = (timer.expiry >> levelShift(level)) & SLOT_MASK;
+    wheel[level][slot].push_back({id, timer.version});
+}
+
+void TimerWheel::cascade(int level)
+{
+    Slot entries;
+    entries.swap(wheel[level][(currentTick >> levelShift(level)) & SLOT_MASK]);
+    for (const auto &entry : entries)
+    {
+        if (isLive(entry))
+        {
+            place(entry.id, timers.at(entry.id));
+        }
+    }
+}
+
+size_t TimerWheel::fireSlot(Slot &slot)
+{
+    if (slot.empty())
+    {
+        return 0;
+    }
+
+    Slot entries;
+    entries.swap(slot);
+
+    size_t fired = 0;
+    for (const auto &entry : entries)
+    {
+        if (!isLive(entry))
+        {
+            continue;
+        }
+
+        auto it = timers.find(entry.id);
+        if (it->second.expiry > currentTick)
+        {
+            place(entry.id, it->second);
+            continue;
+        }
+
+        Callback callback = std::move(it->second.callback);
+        timers.erase(it);
+        if (callback)
+        {
+            callback(entry.id);
+        }
+        ++fired;
+    }
+    return fired;
+}
+
+bool TimerWheel::isLive(const SlotEntry &entry) const
+{
+    auto it = timers.find(entry.id);
+    return it != timers.end() && it->second.version == entry.version;
+}
@@ -0,0 +1,158 @@
+#include "../../include/core/Tracing.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+constexpr double NANOSECONDS_PER_MICROSECOND = 1000.0;
+constexpr int TRACE_PROCESS_ID = 1;
+
+struct ThreadBuffer
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> ring = std::vector<TraceEvent>(Tracer::RING_CAPACITY);
+    uint64_t written = 0;
+    uint32_t threadId = 0;
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    uint32_t nextThreadId = 1;
+};
+
+Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+ThreadBuffer &localBuffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []()
+    {
+        auto created = std::make_shared<ThreadBuffer>();
+        Registry &reg = registry();
+        std::scoped_lock lock(reg.mutex);
+        created->threadId = reg.nextThreadId++;
+        reg.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+const std::chrono::steady_clock::time_point &traceEpoch()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+void writeEscaped(std::ostream &out, std::string_view text)
+{
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out << '\\';
+        }
+        out << c;
+    }
+}
+} 
+
+std::atomic<bool> Tracer::enabled{false};
+
+void Tracer::configureFromEnvironment()
+{
+    const char *value = std::getenv(ENVIRONMENT_VARIABLE);
+    setEnabled(value != nullptr && *value != '\0' && std::string_view(value) != "0");
+}
+
+int64_t Tracer::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch())
+        .count();
+}
+
+void Tracer::record(const char *name, int64_t startNs, int64_t endNs)
+{
+    ThreadBuffer &buffer = localBuffer();
+    std::scoped_lock lock(buffer.mutex);
+    buffer.ring[buffer.written % RING_CAPACITY] = {name, startNs, endNs - startNs};
+    ++buffer.written;
+}
+
+void Tracer::clear()
+{
+    Registry &reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    for (const auto &buffer : reg.buffers)
+    {
+        std::scoped_lock bufferLock(buffer->mutex);
+        buffer->written = 0;
+    }
+}
+
+size_t Tracer::getEventCount()
+{
+    Registry &reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    size_t count = 0;
+    for (const auto &buffer : reg.buffers)
+    {
+        std::scoped_lock bufferLock(buffer->mutex);
+        count += std::min<uint64_t>(buffer->written, RING_CAPACITY);
+    }
+    return count;
+}
+
+size_t Tracer::exportChromeTrace(const std::string &filename)
+{
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file for writing: " + filename);
+    }
+
+    file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    size_t exported = 0;
+
+    Registry &reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    for (const auto &buffer : reg.buffers)
+    {
+        std::vector<TraceEvent> events;
+        {
+            std::scoped_lock bufferLock(buffer->mutex);
+            uint64_t count = std::min<uint64_t>(buffer->written, RING_CAPACITY);
+            events.reserve(count);
+            for (uint64_t i = buffer->written - count; i < buffer->written; ++i)
+            {
+                events.push_back(buffer->ring[i % RING_CAPACITY]);
+            }
+        }
+
+        for (const auto &event : events)
+        {
+            file << (exported == 0 ? "\n" : ",\n") << "{\"name\":\"";
+            writeEscaped(file, event.name);
+            file << "\",\"cat\":\"estate\",\"ph\":\"X\",\"ts\":"
+                 << static_cast<double>(event.startNs) / NANOSECONDS_PER_MICROSECOND
+                 << ",\"dur\":" << static_cast<double>(event.durationNs) / NANOSECONDS_PER_MICROSECOND
+                 << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << buffer->threadId << "}";
+            ++exported;
+        }
+    }
+
+    file << "\n]}\n";
+    return exported;
+}
@@ -11,9 +11,9 @@ constexpr int MIN_FLOOR = 1;
 constexpr int MAX_FLOOR = 100;
 } 
 
-Apartment::Apartment(const ApartmentParams &params)
+Apartment::Apartment(const ApartmentParams &params, const allocator_type &allocator)
     : Property(params.base.id, params.base.city, params.base.street, params.base.house, params.base.price,
-               params.base.area, params.base.description),
+               params.base.area, params.base.description, allocator),
       rooms(params.rooms), floor(params.floor), hasBalcony(params.hasBalcony), hasElevator(params.hasElevator)
 {
     if (params.rooms < MIN_ROOMS || params.rooms > MAX_ROOMS)
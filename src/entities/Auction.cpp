@@ -1,5 +1,6 @@
 #include "../../include/entities/Auction.h"
 #include "../../include/core/Constants.h"
+#include "../../include/core/MemoryUsage.h"
 #include "../../include/core/Utils.h"
 #include <compare>
 #include <format>
@@ -7,18 +8,18 @@
 
 namespace
 {
-constexpr double MIN_PRICE = 0.0;
-constexpr double BUYOUT_MULTIPLIER = 1.7;
-constexpr double MIN_BID_INCREMENT = 0.01;
-constexpr double NO_BID = 0.0;
+constexpr Money MIN_PRICE = Money::fromKopecks(0);
+constexpr int64_t BUYOUT_MULTIPLIER_NUMERATOR = 17;
+constexpr int64_t BUYOUT_MULTIPLIER_DENOMINATOR = 10;
+constexpr Money NO_BID = Money::fromKopecks(0);
 constexpr const char *const DATE_FORMAT = "%Y-%m-%d %H:%M:%S";
-constexpr int PRICE_PRECISION = 2;
 } 
 
 Auction::Auction(const std::string &id, const std::string &propertyId, const std::string &propertyAddress,
-                 double startingPrice)
-    : id(id), propertyId(propertyId), propertyAddress(propertyAddress), startingPrice(startingPrice),
-      buyoutPrice(startingPrice * BUYOUT_MULTIPLIER)
+                 Money startingPrice, const allocator_type &allocator)
+    : id(id, allocator), propertyId(propertyId, allocator), propertyAddress(propertyAddress, allocator),
+      startingPrice(startingPrice), buyoutPrice(calculateBuyoutPrice(startingPrice)),
+      status(Constants::AuctionStatus::ACTIVE, allocator), createdAt(allocator), completedAt(allocator)
 {
     if (startingPrice <= MIN_PRICE)
     {
@@ -44,65 +45,41 @@ bool Auction::addBid(std::shared_ptr<Bid> bid)
         return false;
     }
 
-    double currentHighest = getCurrentHighestBid();
-
     if (bid->getAmount() >= buyoutPrice)
     {
-        bids.push_back(bid);
+        addBidDirect(bid);
         complete();
         return true;
     }
 
-    if (double minBid = (currentHighest > NO_BID) ? currentHighest + MIN_BID_INCREMENT : startingPrice;
-        bid->getAmount() < minBid)
+    if (bid->getAmount() < getMinimumNextBid())
     {
         return false;
     }
 
-    bids.push_back(bid);
+    addBidDirect(bid);
     return true;
 }
 
-void Auction::addBidDirect(std::shared_ptr<Bid> bid) { bids.push_back(bid); }
-
-double Auction::getCurrentHighestBid() const
+void Auction::addBidDirect(std::shared_ptr<Bid> bid)
 {
-    if (bids.empty())
+    if (bid->getAmount() > getCurrentHighestBid())
     {
-        return NO_BID;
+        highestBid = bid.get();
     }
-
-    double maxBid = NO_BID;
-    for (const auto &bid : bids)
-    {
-        if (bid->getAmount() > maxBid)
-        {
-            maxBid = bid->getAmount();
-        }
-    }
-    return maxBid;
+    bids.push_back(bid);
 }
 
-const Bid *Auction::getHighestBid() const
-{
-    if (bids.empty())
-    {
-        return nullptr;
-    }
+Money Auction::getCurrentHighestBid() const { return highestBid != nullptr ? highestBid->getAmount() : NO_BID; }
 
-    const Bid *highest = nullptr;
-    double maxBid = NO_BID;
-    for (const auto &bid : bids)
-    {
-        if (bid->getAmount() > maxBid)
-        {
-            maxBid = bid->getAmount();
-            highest = bid.get();
-        }
-    }
-    return highest;
+Money Auction::getMinimumNextBid() const
+{
+    Money currentHighest = getCurrentHighestBid();
+    return currentHighest > NO_BID ? currentHighest + MIN_BID_INCREMENT : startingPrice;
 }
 
+const Bid *Auction::getHighestBid() const { return highestBid; }
+
 void Auction::complete()
 {
     if (status == Constants::AuctionStatus::ACTIVE)
@@ -121,6 +98,19 @@ void Auction::cancel()
     }
 }
 
+void Auction::detachProperty() { propertyId.clear(); }
+
+void Auction::setTimestamps(const std::string &newCreatedAt, const std::string &newCompletedAt)
+{
+    if (!Utils::parseTime(newCreatedAt, DATE_FORMAT) ||
+        (!newCompletedAt.empty() && !Utils::parseTime(newCompletedAt, DATE_FORMAT)))
+    {
+        throw std::invalid_argument("Invalid auction timestamp format");
+    }
+    createdAt = newCreatedAt;
+    completedAt = newCompletedAt;
+}
+
 bool Auction::wasBuyout() const
 {
     if (!isCompleted() || bids.empty())
@@ -132,14 +122,50 @@ bool Auction::wasBuyout() const
     return highest != nullptr && highest->getAmount() >= buyoutPrice;
 }
 
+std::string Auction::getEndTimeString() const
+{
+    return hasDeadline() ? Utils::formatTime(endTime, DATE_FORMAT) : std::string();
+}
+
+void Auction::setEndTime(std::time_t time)
+{
+    if (time < 0)
+    {
+        throw std::invalid_argument("End time cannot be negative");
+    }
+    endTime = time;
+}
+
+Money Auction::calculateBuyoutPrice(Money startingPrice)
+{
+    return startingPrice.scaled(BUYOUT_MULTIPLIER_NUMERATOR, BUYOUT_MULTIPLIER_DENOMINATOR);
+}
+
 std::string Auction::toString() const
 {
-    return std::format("Auction ID: {}, Property: {}, Starting: {:.2f} руб., Status: {}, Bids: {}", id, propertyAddress,
-                       startingPrice, status, bids.size());
+    return std::format("Auction ID: {}, Property: {}, Starting: {} руб., Status: {}, Bids: {}", id, propertyAddress,
+                       startingPrice.toString(), status, bids.size());
 }
 
 std::string Auction::toFileString() const
 {
-    return std::format("{}|{}|{}|{:.2f}|{:.2f}|{}|{}|{}", id, propertyId, propertyAddress, startingPrice, buyoutPrice,
-                       status, createdAt, completedAt);
+    return std::format("{}|{}|{}|{}|{}|{}|{}|{}|{}", id, propertyId, propertyAddress, startingPrice.toString(),
+                       buyoutPrice.toString(), status, createdAt, completedAt, getEndTimeString());
+}
+
+size_t Auction::getStringBytes() const
+{
+    return Memory::stringHeapBytes(id) + Memory::stringHeapBytes(propertyId) +
+           Memory::stringHeapBytes(propertyAddress) + Memory::stringHeapBytes(status) +
+           Memory::stringHeapBytes(createdAt) + Memory::stringHeapBytes(completedAt);
+}
+
+size_t Auction::getBidBytes() const
+{
+    size_t bytes = Memory::vectorHeapBytes(bids);
+    for (const auto &bid : bids)
+    {
+        bytes += sizeof(Bid) + Memory::SHARED_CONTROL_BLOCK_BYTES + bid->getStringBytes();
+    }
+    return bytes;
 }
@@ -1,4 +1,5 @@
 #include "../../include/entities/Bid.h"
+#include "../../include/core/MemoryUsage.h"
 #include "../../include/core/Utils.h"
 #include <compare>
 #include <format>
@@ -7,13 +8,12 @@
 
 namespace
 {
-constexpr double MIN_AMOUNT = 0.0;
+constexpr Money MIN_AMOUNT = Money::fromKopecks(0);
 constexpr const char *const DATE_FORMAT = "%Y-%m-%d %H:%M:%S";
-constexpr int PRICE_PRECISION = 2;
 } 
 
-Bid::Bid(const std::string &clientId, const std::string &clientName, double amount)
-    : clientId(clientId), clientName(clientName), amount(amount)
+Bid::Bid(const std::string &clientId, const std::string &clientName, Money amount, const allocator_type &allocator)
+    : clientId(clientId, allocator), clientName(clientName, allocator), amount(amount), timestamp(allocator)
 {
     if (amount <= MIN_AMOUNT)
     {
@@ -25,24 +25,25 @@ Bid::Bid(const std::string &clientId, const std::string &clientName, double amou
 
 bool Bid::operator==(const Bid &other) const { return clientId == other.clientId && amount == other.amount; }
 
-std::partial_ordering Bid::operator<=>(const Bid &other) const
+std::strong_ordering Bid::operator<=>(const Bid &other) const
 {
     if (auto cmp = amount <=> other.amount; cmp != 0)
         return cmp;
-    auto strCmp = timestamp <=> other.timestamp;
-    if (strCmp == std::strong_ordering::less)
-        return std::partial_ordering::less;
-    if (strCmp == std::strong_ordering::greater)
-        return std::partial_ordering::greater;
-    return std::partial_ordering::equivalent;
+    return timestamp <=> other.timestamp;
 }
 
 std::string Bid::toString() const
 {
-    return std::format("Client: {} (ID: {}), Amount: {:.2f} руб., Time: {}", clientName, clientId, amount, timestamp);
+    return std::format("Client: {} (ID: {}), Amount: {} руб., Time: {}", clientName, clientId, amount.toString(),
+                       timestamp);
 }
 
 std::string Bid::toFileString() const
 {
-    return std::format("{}|{}|{:.2f}|{}", clientId, clientName, amount, timestamp);
+    return std::format("{}|{}|{}|{}", clientId, clientName, amount.toString(), timestamp);
+}
+
+size_t Bid::getStringBytes() const
+{
+    return Memory::stringHeapBytes(clientId) + Memory::stringHeapBytes(clientName) + Memory::stringHeapBytes(timestamp);
 }
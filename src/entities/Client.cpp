@@ -1,4 +1,5 @@
 #include "../../include/entities/Client.h"
+#include "../../include/core/MemoryUsage.h"
 #include "../../include/core/Utils.h"
 #include <algorithm>
 #include <cctype>
@@ -17,8 +18,10 @@ constexpr size_t MAX_ID_LENGTH = 8;
 constexpr const char *const DATE_FORMAT = "%Y-%m-%d %H:%M:%S";
 } 
 
-Client::Client(const std::string &id, const std::string &name, const std::string &phone, const std::string &email)
-    : id(id), name(name), phone(phone), email(email)
+Client::Client(const std::string &id, const std::string &name, const std::string &phone, const std::string &email,
+               const allocator_type &allocator)
+    : id(id, allocator), name(name, allocator), phone(phone, allocator), email(email, allocator),
+      registrationDate(allocator)
 {
     if (!validateId(id))
     {
@@ -46,7 +49,7 @@ void Client::setName(std::string_view newName)
     {
         throw std::invalid_argument("Name cannot be empty");
     }
-    name = std::string(newName);
+    name = newName;
 }
 
 void Client::setPhone(std::string_view newPhone)
@@ -55,7 +58,7 @@ void Client::setPhone(std::string_view newPhone)
     {
         throw std::invalid_argument("Invalid phone number format");
     }
-    phone = std::string(newPhone);
+    phone = newPhone;
 }
 
 void Client::setEmail(std::string_view newEmail)
@@ -64,7 +67,16 @@ void Client::setEmail(std::string_view newEmail)
     {
         throw std::invalid_argument("Invalid email format");
     }
-    email = std::string(newEmail);
+    email = newEmail;
+}
+
+void Client::setRegistrationDate(const std::string &date)
+{
+    if (!Utils::parseTime(date, DATE_FORMAT))
+    {
+        throw std::invalid_argument("Invalid registration date format");
+    }
+    registrationDate = date;
 }
 
 bool Client::validateId(std::string_view id)
@@ -95,3 +107,9 @@ std::string Client::toString() const
     oss << *this;
     return oss.str();
 }
+
+size_t Client::getStringBytes() const
+{
+    return Memory::stringHeapBytes(id) + Memory::stringHeapBytes(name) + Memory::stringHeapBytes(phone) +
+           Memory::stringHeapBytes(email) + Memory::stringHeapBytes(registrationDate);
+}
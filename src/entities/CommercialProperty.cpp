@@ -10,10 +10,10 @@ constexpr int MIN_PARKING_SPACES = 0;
 constexpr int MAX_PARKING_SPACES = 1000;
 } 
 
-CommercialProperty::CommercialProperty(const CommercialPropertyParams &params)
+CommercialProperty::CommercialProperty(const CommercialPropertyParams &params, const allocator_type &allocator)
     : Property(params.base.id, params.base.city, params.base.street, params.base.house, params.base.price,
-               params.base.area, params.base.description),
-      businessType(params.businessType), hasParking(params.hasParking), parkingSpaces(params.parkingSpaces),
+               params.base.area, params.base.description, allocator),
+      hasParking(params.hasParking), parkingSpaces(params.parkingSpaces),
       isVisibleFromStreet(params.isVisibleFromStreet)
 {
     if (params.businessType.empty())
@@ -24,6 +24,7 @@ CommercialProperty::CommercialProperty(const CommercialPropertyParams &params)
     {
         throw std::invalid_argument("Parking spaces must be between 0 and 1000");
     }
+    businessType = StringPool::instance().intern(params.businessType);
 }
 
 std::string CommercialProperty::getType() const { return "Commercial"; }
@@ -31,7 +32,7 @@ std::string CommercialProperty::getType() const { return "Commercial"; }
 void CommercialProperty::displayInfo() const
 {
     std::cout << *this << "\n";
-    std::cout << "Business Type: " << businessType << "\n";
+    std::cout << "Business Type: " << getBusinessType() << "\n";
     std::cout << "Parking: " << (hasParking ? "Yes" : "No") << "\n";
     std::cout << "Parking Spaces: " << parkingSpaces << "\n";
     std::cout << "Visible from Street: " << (isVisibleFromStreet ? "Yes" : "No") << "\n";
@@ -41,8 +42,9 @@ std::string CommercialProperty::toFileString() const
 {
     std::ostringstream oss;
     oss << "COMMERCIAL|" << getId() << "|" << getCity() << "|" << getStreet() << "|" << getHouse() << "|" << getPrice()
-        << "|" << getArea() << "|" << getDescription() << "|" << (getIsAvailable() ? "1" : "0") << "|" << businessType
-        << "|" << (hasParking ? "1" : "0") << "|" << parkingSpaces << "|" << (isVisibleFromStreet ? "1" : "0");
+        << "|" << getArea() << "|" << getDescription() << "|" << (getIsAvailable() ? "1" : "0") << "|"
+        << getBusinessType() << "|" << (hasParking ? "1" : "0") << "|" << parkingSpaces << "|"
+        << (isVisibleFromStreet ? "1" : "0");
     return oss.str();
 }
 
@@ -50,7 +52,7 @@ Property *CommercialProperty::clone() const
 {
     CommercialPropertyParams params{
         {getId(), getCity(), getStreet(), getHouse(), getPrice(), getArea(), getDescription()},
-        businessType,
+        getBusinessType(),
         hasParking,
         parkingSpaces,
         isVisibleFromStreet};
@@ -63,7 +65,7 @@ void CommercialProperty::setBusinessType(std::string_view type)
     {
         throw std::invalid_argument("Business type cannot be empty");
     }
-    businessType = std::string(type);
+    businessType = StringPool::instance().intern(type);
 }
 
 void CommercialProperty::setParkingSpaces(int spaces)
@@ -13,9 +13,9 @@ constexpr double MIN_LAND_AREA = 0.0;
 constexpr double MAX_LAND_AREA = 10000.0;
 } 
 
-House::House(const HouseParams &params)
+House::House(const HouseParams &params, const allocator_type &allocator)
     : Property(params.base.id, params.base.city, params.base.street, params.base.house, params.base.price,
-               params.base.area, params.base.description),
+               params.base.area, params.base.description, allocator),
       floors(params.floors), rooms(params.rooms), landArea(params.landArea), hasGarage(params.hasGarage),
       hasGarden(params.hasGarden)
 {
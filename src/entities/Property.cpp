@@ -1,4 +1,5 @@
 #include "../../include/entities/Property.h"
+#include "../../include/core/MemoryUsage.h"
 #include <algorithm>
 #include <cctype>
 #include <compare>
@@ -7,8 +8,8 @@
 #include <string_view>
 
 Property::Property(const std::string &id, const std::string &city, const std::string &street, const std::string &house,
-                   double price, double area, const std::string &description)
-    : id(id), city(city), street(street), house(house), price(price), area(area), description(description)
+                   Money price, double area, const std::string &description, const allocator_type &allocator)
+    : id(id, allocator), house(house, allocator), price(price), area(area), description(description, allocator)
 {
     if (!validateId(id))
     {
@@ -34,13 +35,21 @@ Property::Property(const std::string &id, const std::string &city, const std::st
     {
         throw std::invalid_argument("Invalid area: must be positive");
     }
+    this->city = StringPool::instance().intern(city);
+    this->street = StringPool::instance().intern(street);
+}
+
+std::string Property::getAddress() const
+{
+    const auto &pool = StringPool::instance();
+    return std::format("{}, {}, {}", pool.resolve(city), pool.resolve(street), house);
 }
 
 bool Property::operator==(const Property &other) const { return id == other.id; }
 
-std::partial_ordering Property::operator<=>(const Property &other) const { return price <=> other.price; }
+std::strong_ordering Property::operator<=>(const Property &other) const { return price <=> other.price; }
 
-void Property::setPrice(double newPrice)
+void Property::setPrice(Money newPrice)
 {
     if (!validatePrice(newPrice))
     {
@@ -72,17 +81,17 @@ void Property::setAddress(const std::string &newCity, const std::string &newStre
     {
         throw std::invalid_argument("Invalid house");
     }
-    city = newCity;
-    street = newStreet;
+    city = StringPool::instance().intern(newCity);
+    street = StringPool::instance().intern(newStreet);
     house = newHouse;
 }
 
-void Property::setDescription(std::string_view newDesc) { description = std::string(newDesc); }
+void Property::setDescription(std::string_view newDesc) { description = newDesc; }
 
-bool Property::validatePrice(double price)
+bool Property::validatePrice(Money price)
 {
-    constexpr double MIN_PRICE = 10000.0;
-    constexpr double MAX_PRICE = 1000000000.0;
+    constexpr Money MIN_PRICE = Money::fromRubles(10000);
+    constexpr Money MAX_PRICE = Money::fromRubles(1000000000);
     return price >= MIN_PRICE && price <= MAX_PRICE;
 }
 
@@ -113,3 +122,8 @@ bool Property::validateAddressPart(std::string_view part)
 
     return std::ranges::any_of(part, [](char c) { return std::isprint(static_cast<unsigned char>(c)); });
 }
+
+size_t Property::getStringBytes() const
+{
+    return Memory::stringHeapBytes(id) + Memory::stringHeapBytes(house) + Memory::stringHeapBytes(description);
+}
@@ -1,5 +1,6 @@
 #include "../../include/entities/Transaction.h"
 #include "../../include/core/Constants.h"
+#include "../../include/core/MemoryUsage.h"
 #include "../../include/core/Utils.h"
 #include <algorithm>
 #include <cctype>
@@ -13,13 +14,15 @@ namespace
 {
 constexpr size_t MIN_ID_LENGTH = 6;
 constexpr size_t MAX_ID_LENGTH = 8;
-constexpr double MIN_PRICE = 0.0;
+constexpr Money MIN_PRICE = Money::fromKopecks(0);
 constexpr const char *const DATE_FORMAT = "%Y-%m-%d %H:%M:%S";
 } 
 
 Transaction::Transaction(const std::string &id, const std::string &propertyId, const std::string &clientId,
-                         double finalPrice, const std::string &status, const std::string &notes)
-    : id(id), propertyId(propertyId), clientId(clientId), finalPrice(finalPrice), status(status), notes(notes)
+                         Money finalPrice, const std::string &status, const std::string &notes,
+                         const allocator_type &allocator)
+    : id(id, allocator), propertyId(propertyId, allocator), clientId(clientId, allocator), date(allocator),
+      finalPrice(finalPrice), status(status, allocator), notes(notes, allocator)
 {
     if (!validateId(id))
     {
@@ -57,10 +60,10 @@ void Transaction::setStatus(std::string_view newStatus)
     {
         throw std::invalid_argument("Invalid status");
     }
-    status = std::string(newStatus);
+    status = newStatus;
 }
 
-void Transaction::setFinalPrice(double newPrice)
+void Transaction::setFinalPrice(Money newPrice)
 {
     if (newPrice <= MIN_PRICE)
     {
@@ -69,7 +72,16 @@ void Transaction::setFinalPrice(double newPrice)
     finalPrice = newPrice;
 }
 
-void Transaction::setNotes(std::string_view newNotes) { notes = std::string(newNotes); }
+void Transaction::setNotes(std::string_view newNotes) { notes = newNotes; }
+
+void Transaction::setDate(const std::string &newDate)
+{
+    if (!Utils::parseTime(newDate, DATE_FORMAT))
+    {
+        throw std::invalid_argument("Invalid date format");
+    }
+    date = newDate;
+}
 
 std::string Transaction::toString() const
 {
@@ -95,3 +107,9 @@ bool Transaction::validateId(std::string_view id)
 
     return std::ranges::all_of(id, [](char c) { return std::isdigit(static_cast<unsigned char>(c)); });
 }
+
+size_t Transaction::getStringBytes() const
+{
+    return Memory::stringHeapBytes(id) + Memory::stringHeapBytes(propertyId) + Memory::stringHeapBytes(clientId) +
+           Memory::stringHeapBytes(date) + Memory::stringHeapBytes(status) + Memory::stringHeapBytes(notes);
+}
@@ -1,3 +1,5 @@
+#include "../include/core/Metrics.h"
+#include "../include/core/Tracing.h"
 #include "../include/ui/MainWindow.h"
 #include <QApplication>
 #include <QLoggingCategory>
@@ -11,6 +13,8 @@ constexpr const char *APPLICATION_STYLE = "Fusion";
 int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
+    Tracer::configureFromEnvironment();
+    MetricsRegistry::instance().configureFromEnvironment();
 
     try
     {
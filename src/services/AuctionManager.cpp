@@ -1,4 +1,6 @@
 #include "../../include/services/AuctionManager.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include <algorithm>
 #include <ranges>
 #include <string_view>
@@ -15,41 +17,65 @@ void AuctionManager::addAuction(std::shared_ptr<Auction> auction)
     {
         throw AuctionManagerException("Auction with ID " + auction->getId() + " already exists");
     }
+    rows.append(auction->getId());
     auctions.push_back(auction);
+    byProperty.add(auction->getPropertyId(), auction.get());
 }
 
 bool AuctionManager::removeAuction(const std::string &id)
 {
-    if (auto removed = std::ranges::remove_if(auctions, [&id](const std::shared_ptr<Auction> &auction)
-                                              { return auction->getId() == id; });
-        removed.begin() != auctions.end())
+    size_t row = rows.find(id);
+    if (row == RowDirectory::NO_ROW)
     {
-        auctions.erase(removed.begin(), auctions.end());
-        return true;
+        return false;
     }
-    return false;
+    Auction *auction = auctions[row].get();
+    byProperty.remove(auction->getPropertyId(), auction);
+    rows.remove(auctions, row);
+    rows.compactIfNeeded(auctions);
+    return true;
 }
 
-Auction *AuctionManager::findAuction(const std::string &id) const
+size_t AuctionManager::removeAuctionsByProperty(const std::string &propertyId)
 {
-    if (auto it = std::ranges::find_if(auctions, [&id](const std::shared_ptr<Auction> &auction)
-                                       { return auction->getId() == id; });
-        it != auctions.end())
+    std::vector<Auction *> removed = byProperty.extract(propertyId);
+    for (Auction *auction : removed)
     {
-        return it->get();
+        rows.remove(auctions, rows.find(auction->getId()));
     }
-    return nullptr;
+    rows.compactIfNeeded(auctions);
+    return removed.size();
 }
 
-std::vector<Auction *> AuctionManager::getAllAuctions() const
+size_t AuctionManager::detachAuctionsFromProperty(const std::string &propertyId)
 {
-    std::vector<Auction *> result;
-    result.reserve(auctions.size());
-    for (const auto &auction : auctions)
+    std::vector<Auction *> detached = byProperty.extract(propertyId);
+    for (Auction *auction : detached)
     {
-        result.push_back(auction.get());
+        auction->detachProperty();
     }
-    return result;
+    return detached.size();
+}
+
+const std::shared_ptr<Auction> *AuctionManager::findEntry(const std::string &id) const
+{
+    static Counter &hits = MetricsRegistry::instance().counter("auction.lookup.hits");
+    static Counter &misses = MetricsRegistry::instance().counter("auction.lookup.misses");
+    size_t row = rows.find(id);
+    (row != RowDirectory::NO_ROW ? hits : misses).increment();
+    return row != RowDirectory::NO_ROW ? &auctions[row] : nullptr;
+}
+
+Auction *AuctionManager::findAuction(const std::string &id) const
+{
+    const std::shared_ptr<Auction> *entry = findEntry(id);
+    return entry != nullptr ? entry->get() : nullptr;
+}
+
+std::shared_ptr<Auction> AuctionManager::findSharedAuction(const std::string &id) const
+{
+    const std::shared_ptr<Auction> *entry = findEntry(id);
+    return entry != nullptr ? *entry : nullptr;
 }
 
 std::vector<Auction *> AuctionManager::getActiveAuctions() const
@@ -57,7 +83,7 @@ std::vector<Auction *> AuctionManager::getActiveAuctions() const
     std::vector<Auction *> result;
     for (const auto &auction : auctions)
     {
-        if (auction->isActive())
+        if (auction && auction->isActive())
         {
             result.push_back(auction.get());
         }
@@ -70,7 +96,7 @@ std::vector<Auction *> AuctionManager::getCompletedAuctions() const
     std::vector<Auction *> result;
     for (const auto &auction : auctions)
     {
-        if (auction->isCompleted())
+        if (auction && auction->isCompleted())
         {
             result.push_back(auction.get());
         }
@@ -78,15 +104,100 @@ std::vector<Auction *> AuctionManager::getCompletedAuctions() const
     return result;
 }
 
+GroupedAggregate<std::string> AuctionManager::aggregateByStatus() const
+{
+    METRIC_TIME_SCOPE("auction.aggregate_by_status.duration_ns");
+    return aggregate([](const Auction &auction) { return std::optional(auction.getStatus()); });
+}
+
+GroupedAggregate<PropertyKind> AuctionManager::aggregateClearingByKind(const PropertyManager &properties) const
+{
+    TRACE_SCOPE("AuctionManager::aggregateClearingByKind");
+    METRIC_TIME_SCOPE("auction.aggregate_clearing_by_kind.duration_ns");
+    auto propertyRows = properties.getIdRows();
+    const auto &propertyList = properties.getProperties();
+    return groupRows<PropertyKind>(
+        auctions.size(),
+        [this, &propertyRows, &propertyList](size_t row) -> std::optional<PropertyKind>
+        {
+            if (!auctions[row] || auctions[row]->isActive())
+            {
+                return std::nullopt;
+            }
+            auto it = propertyRows->find(auctions[row]->getPropertyId());
+            if (it == propertyRows->end())
+            {
+                return std::nullopt;
+            }
+            return PropertyColumns::kindOf(*propertyList[it->second]);
+        },
+        [this](AggregateStats &stats, size_t row)
+        {
+            const Auction &auction = *auctions[row];
+            if (const Bid *highest = auction.getHighestBid(); auction.isCompleted() && highest != nullptr)
+            {
+                stats.add(highest->getAmount());
+            }
+            else
+            {
+                stats.addWithoutValue();
+            }
+        });
+}
+
 std::vector<Auction *> AuctionManager::getAuctionsByProperty(std::string_view propertyId) const
 {
-    std::vector<Auction *> result;
+    auto found = byProperty.find(propertyId);
+    return {found.begin(), found.end()};
+}
+
+std::vector<Auction *> AuctionManager::getMostRecent(size_t k) const
+{
+    return topK(k, [](const Auction &left, const Auction &right) { return right < left; });
+}
+
+std::vector<Auction *> AuctionManager::getEndingSoonest(size_t k) const
+{
+    return topK(
+        k, [](const Auction &left, const Auction &right) { return left.getEndTime() < right.getEndTime(); },
+        [](const Auction &auction) { return auction.isActive(); });
+}
+
+MemoryUsage AuctionManager::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objectCount = getCount();
+    usage.objectBytes = getCount() * (sizeof(Auction) + Memory::SHARED_CONTROL_BLOCK_BYTES);
+    usage.indexBytes =
+        Memory::vectorHeapBytes(auctions) + rows.getMemoryBytes() + byProperty.getMemoryBytes();
+    usage.arenaBytes = arena ? arena->getReservedBytes() : 0;
     for (const auto &auction : auctions)
     {
-        if (auction->getPropertyId() == propertyId)
+        if (!auction)
         {
-            result.push_back(auction.get());
+            continue;
         }
+        usage.stringBytes += auction->getStringBytes();
+        usage.bidCount += auction->getBidCount();
+        usage.bidBytes += auction->getBidBytes();
+    }
+    return usage;
+}
+
+void AuctionManager::setAuctions(std::vector<std::shared_ptr<Auction>> &&newAuctions,
+                                 std::shared_ptr<EntityArena> newArena)
+{
+    auctions = std::move(newAuctions);
+    arena = std::move(newArena);
+    rows.rebuild(auctions);
+    rebuildReferences();
+}
+
+void AuctionManager::rebuildReferences()
+{
+    byProperty.clear();
+    for (const auto &auction : auctions)
+    {
+        byProperty.add(auction->getPropertyId(), auction.get());
     }
-    return result;
 }
@@ -0,0 +1,130 @@
+#include "../../include/services/AuctionScheduler.h"
+#include "../../include/services/AuctionSettlement.h"
+#include <stdexcept>
+
+namespace
+{
+constexpr std::time_t DEFAULT_SNIPING_WINDOW = 5 * 60;
+constexpr std::time_t DEFAULT_SNIPING_EXTENSION = 5 * 60;
+} 
+
+AuctionScheduler::AuctionScheduler(AuctionManager &auctionManager, TransactionManager &transactionManager,
+                                   PropertyManager &propertyManager)
+    : auctionManager(auctionManager), transactionManager(transactionManager), propertyManager(propertyManager),
+      wheel(std::time(nullptr)), snipingWindow(DEFAULT_SNIPING_WINDOW), snipingExtension(DEFAULT_SNIPING_EXTENSION)
+{
+}
+
+void AuctionScheduler::scheduleAuction(const Auction &auction)
+{
+    if (!auction.isActive() || !auction.hasDeadline())
+    {
+        unscheduleAuction(auction.getId());
+        return;
+    }
+
+    if (auto it = timersByAuction.find(auction.getId()); it != timersByAuction.end())
+    {
+        wheel.reschedule(it->second, auction.getEndTime());
+        return;
+    }
+
+    std::string auctionId = auction.getId();
+    TimerWheel::TimerId timerId =
+        wheel.schedule(auction.getEndTime(), [this, auctionId](TimerWheel::TimerId) { onDeadline(auctionId); });
+    timersByAuction.emplace(auctionId, timerId);
+}
+
+void AuctionScheduler::unscheduleAuction(const std::string &auctionId)
+{
+    if (auto it = timersByAuction.find(auctionId); it != timersByAuction.end())
+    {
+        wheel.cancel(it->second);
+        timersByAuction.erase(it);
+    }
+}
+
+void AuctionScheduler::rescheduleAll()
+{
+    for (const auto &[auctionId, timerId] : timersByAuction)
+    {
+        wheel.cancel(timerId);
+    }
+    timersByAuction.clear();
+
+    for (const auto &auction : auctionManager.getAuctions())
+    {
+        if (auction)
+        {
+            scheduleAuction(*auction);
+        }
+    }
+}
+
+bool AuctionScheduler::onBidAccepted(Auction &auction, std::time_t now)
+{
+    if (!auction.isActive())
+    {
+        unscheduleAuction(auction.getId());
+        return false;
+    }
+
+    if (!auction.hasDeadline() || auction.getEndTime() - now > snipingWindow)
+    {
+        return false;
+    }
+
+    auction.setEndTime(now + snipingExtension);
+    scheduleAuction(auction);
+    return true;
+}
+
+size_t AuctionScheduler::tick(std::time_t now) { return wheel.advance(now); }
+
+void AuctionScheduler::setAntiSniping(std::time_t window, std::time_t extension)
+{
+    if (window < 0 || extension < 0)
+    {
+        throw std::invalid_argument("Anti-sniping window and extension cannot be negative");
+    }
+    snipingWindow = window;
+    snipingExtension = extension;
+}
+
+void AuctionScheduler::onDeadline(const std::string &auctionId)
+{
+    timersByAuction.erase(auctionId);
+
+    Auction *auction = auctionManager.findAuction(auctionId);
+    if (auction == nullptr || !auction->isActive())
+    {
+        return;
+    }
+
+    std::shared_ptr<Transaction> transaction;
+    if (auction->getHighestBid() == nullptr)
+    {
+        auction->cancel();
+    }
+    else
+    {
+        auction->complete();
+        try
+        {
+            transaction = AuctionSettlement::settle(*auction, transactionManager, propertyManager);
+        }
+        catch (const std::invalid_argument &)
+        {
+            transaction = nullptr;
+        }
+        catch (const TransactionManagerException &)
+        {
+            transaction = nullptr;
+        }
+    }
+
+    if (settlementCallback)
+    {
+        settlementCallback(*auction, transaction.get());
+    }
+}
@@ -0,0 +1,142 @@
+#include "../../include/services/AuctionSettlement.h"
+#include "../../include/core/Constants.h"
+#include "../../include/core/Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <ctime>
+#include <format>
+#include <iomanip>
+#include <ranges>
+#include <sstream>
+
+namespace
+{
+bool hasExistingTransaction(const TransactionManager &transactionManager, const std::string &propertyId,
+                            const std::string &clientId, Money amount)
+{
+    auto existingTransactions = transactionManager.getTransactionsByProperty(propertyId);
+    return std::ranges::any_of(existingTransactions,
+                               [&clientId, amount](const Transaction *trans)
+                               {
+                                   return trans->getClientId() == clientId &&
+                                          trans->getStatus() == Constants::TransactionStatus::COMPLETED &&
+                                          trans->getFinalPrice() == amount;
+                               });
+}
+
+std::string generateBaseTransactionId()
+{
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+    auto tm = Utils::getLocalTime(time);
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%H%M%S");
+    std::string transactionId = oss.str();
+
+    if (transactionId.length() < 8)
+    {
+        transactionId += std::to_string(tm.tm_mday % 100);
+    }
+
+    if (transactionId.length() > 8)
+    {
+        transactionId = transactionId.substr(0, 8);
+    }
+    if (transactionId.length() < 6)
+    {
+        transactionId = transactionId + std::string(6 - transactionId.length(), '0');
+    }
+
+    return transactionId;
+}
+
+std::string generateFallbackTransactionId(const std::string &auctionId)
+{
+    std::string cleanId;
+    for (char c : auctionId)
+    {
+        if (std::isdigit(static_cast<unsigned char>(c)))
+            cleanId += c;
+    }
+
+    std::string transactionId;
+    if (cleanId.length() >= 6)
+    {
+        transactionId = cleanId.substr(0, 6);
+    }
+    else
+    {
+        transactionId = cleanId + std::string(6 - cleanId.length(), '0');
+    }
+
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+    transactionId += std::to_string(time % 100);
+    if (transactionId.length() > 8)
+        transactionId = transactionId.substr(0, 8);
+
+    return transactionId;
+}
+
+std::string ensureUniqueTransactionId(const TransactionManager &transactionManager, const std::string &baseId,
+                                      const std::string &auctionId)
+{
+    std::string transactionId = baseId;
+    std::string originalId = baseId;
+    int suffix = 1;
+
+    while (transactionManager.findTransaction(transactionId) != nullptr)
+    {
+        if (transactionId.length() < 8)
+        {
+            transactionId = std::format("{}{}", originalId, suffix % 10);
+            if (transactionId.length() > 8)
+            {
+                transactionId = transactionId.substr(0, 8);
+            }
+        }
+        else
+        {
+            transactionId = std::format("{}{}", originalId.substr(0, 6), suffix % 100);
+        }
+        suffix++;
+
+        if (suffix > 999)
+        {
+            transactionId = generateFallbackTransactionId(auctionId);
+            suffix = 1;
+        }
+    }
+
+    return transactionId;
+}
+} 
+
+std::shared_ptr<Transaction> AuctionSettlement::settle(const Auction &auction, TransactionManager &transactionManager,
+                                                       PropertyManager &propertyManager)
+{
+    const Bid *winner = auction.getHighestBid();
+    if (!winner)
+        return nullptr;
+
+    if (hasExistingTransaction(transactionManager, auction.getPropertyId(), winner->getClientId(),
+                               winner->getAmount()))
+        return nullptr;
+
+    std::string baseId = generateBaseTransactionId();
+    std::string transactionId = ensureUniqueTransactionId(transactionManager, baseId, auction.getId());
+
+    std::string notes = "Продажа через аукцион. Аукцион ID: " + auction.getId();
+    auto transaction =
+        std::make_shared<Transaction>(transactionId, auction.getPropertyId(), winner->getClientId(),
+                                      winner->getAmount(), Constants::TransactionStatus::COMPLETED, notes);
+
+    transactionManager.addTransaction(transaction);
+
+    if (const Property *prop = propertyManager.findProperty(auction.getPropertyId()); prop)
+    {
+        propertyManager.setAvailable(prop, false);
+    }
+    return transaction;
+}
@@ -0,0 +1,279 @@
+#include "../../include/services/BidEngine.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/entities/Bid.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+constexpr size_t MAX_BATCH_SIZE = 256;
+} 
+
+BidEngine::BidEngine(AuctionManager &manager, size_t workerCount)
+    : auctionManager(manager),
+      workerCount(workerCount > 0 ? workerCount : std::max<size_t>(1, std::thread::hardware_concurrency()))
+{
+}
+
+BidEngine::~BidEngine() { stop(); }
+
+void BidEngine::start()
+{
+    if (isRunning())
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(readyMutex);
+        stopping = false;
+    }
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&BidEngine::workerLoop, this);
+    }
+}
+
+void BidEngine::stop()
+{
+    if (!isRunning())
+    {
+        return;
+    }
+
+    drain();
+    {
+        std::scoped_lock lock(readyMutex);
+        stopping = true;
+    }
+    readyCondition.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+}
+
+uint64_t BidEngine::submit(BidRequest request)
+{
+    if (!isRunning())
+    {
+        throw BidEngineException("Bid engine is not running");
+    }
+
+    request.submittedNs = MetricsRegistry::nowNs();
+    std::shared_ptr<Lot> lot = findOrCreateLot(request.auctionId);
+    if (!lot)
+    {
+        request.sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+        uint64_t sequence = request.sequence;
+        publish({std::move(request), BidStatus::RejectedUnknownAuction, Money()});
+        return sequence;
+    }
+
+    inFlight.fetch_add(1, std::memory_order_relaxed);
+
+    bool needsScheduling = false;
+    uint64_t sequence = 0;
+    {
+        std::scoped_lock lock(lot->queueMutex);
+        sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+        request.sequence = sequence;
+        lot->pending.push_back(std::move(request));
+        if (!lot->scheduled)
+        {
+            lot->scheduled = true;
+            needsScheduling = true;
+        }
+    }
+
+    if (needsScheduling)
+    {
+        schedule(std::move(lot));
+    }
+    return sequence;
+}
+
+void BidEngine::drain()
+{
+    std::unique_lock lock(drainMutex);
+    drainCondition.wait(lock, [this]() { return inFlight.load(std::memory_order_acquire) == 0; });
+}
+
+void BidEngine::forgetAuction(const std::string &auctionId)
+{
+    std::unique_lock lock(lotsMutex);
+    lots.erase(auctionId);
+    forgottenAuctions.insert(auctionId);
+}
+
+std::shared_ptr<BidEngine::Lot> BidEngine::findOrCreateLot(const std::string &auctionId)
+{
+    {
+        std::shared_lock lock(lotsMutex);
+        if (auto it = lots.find(auctionId); it != lots.end() && !it->second->auction.expired())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(lotsMutex);
+    auto it = lots.find(auctionId);
+    if (it != lots.end() && !it->second->auction.expired())
+    {
+        return it->second;
+    }
+
+    std::shared_ptr<Auction> auction =
+        forgottenAuctions.contains(auctionId) ? nullptr : auctionManager.findSharedAuction(auctionId);
+    if (!auction)
+    {
+        if (it != lots.end())
+        {
+            lots.erase(it);
+        }
+        return nullptr;
+    }
+    if (it != lots.end())
+    {
+        std::scoped_lock queueLock(it->second->queueMutex);
+        it->second->auction = auction;
+        return it->second;
+    }
+
+    auto lot = std::make_shared<Lot>();
+    lot->auctionId = auctionId;
+    lot->auction = auction;
+    lots.emplace(auctionId, lot);
+    return lot;
+}
+
+void BidEngine::schedule(std::shared_ptr<Lot> lot)
+{
+    {
+        std::scoped_lock lock(readyMutex);
+        readyLots.push_back(std::move(lot));
+    }
+    readyCondition.notify_one();
+}
+
+void BidEngine::workerLoop()
+{
+    while (true)
+    {
+        std::shared_ptr<Lot> lot;
+        {
+            std::unique_lock lock(readyMutex);
+            readyCondition.wait(lock, [this]() { return stopping || !readyLots.empty(); });
+            if (readyLots.empty())
+            {
+                return;
+            }
+            lot = std::move(readyLots.front());
+            readyLots.pop_front();
+        }
+        processLot(lot);
+    }
+}
+
+void BidEngine::processLot(const std::shared_ptr<Lot> &lot)
+{
+    std::shared_ptr<Auction> auction;
+    std::vector<BidRequest> batch;
+    batch.reserve(MAX_BATCH_SIZE);
+    {
+        std::scoped_lock lock(lot->queueMutex);
+        auction = lot->auction.lock();
+        while (!lot->pending.empty() && batch.size() < MAX_BATCH_SIZE)
+        {
+            batch.push_back(std::move(lot->pending.front()));
+            lot->pending.pop_front();
+        }
+    }
+
+    for (const auto &request : batch)
+    {
+        publish(auction ? apply(*auction, request) : BidResult{request, BidStatus::RejectedUnknownAuction, Money()});
+    }
+    auction.reset();
+    finish(batch.size());
+
+    bool reschedule = false;
+    {
+        std::scoped_lock lock(lot->queueMutex);
+        if (lot->pending.empty())
+        {
+            lot->scheduled = false;
+        }
+        else
+        {
+            reschedule = true;
+        }
+    }
+
+    if (reschedule)
+    {
+        schedule(lot);
+    }
+}
+
+BidResult BidEngine::apply(Auction &auction, const BidRequest &request) const
+{
+    if (!auction.isActive())
+    {
+        return {request, BidStatus::RejectedClosed, auction.getCurrentHighestBid()};
+    }
+
+    try
+    {
+        auto bid = std::make_shared<Bid>(request.clientId, request.clientName, request.amount);
+        if (!auction.addBid(bid))
+        {
+            return {request, BidStatus::RejectedTooLow, auction.getCurrentHighestBid()};
+        }
+    }
+    catch (const std::invalid_argument &)
+    {
+        return {request, BidStatus::RejectedInvalid, auction.getCurrentHighestBid()};
+    }
+
+    BidStatus status = auction.isActive() ? BidStatus::Accepted : BidStatus::Buyout;
+    return {request, status, auction.getCurrentHighestBid()};
+}
+
+void BidEngine::publish(const BidResult &result)
+{
+    static Histogram &latency = MetricsRegistry::instance().histogram("bid.latency_ns");
+    static Counter &accepted = MetricsRegistry::instance().counter("bid.accepted");
+    static Counter &rejected = MetricsRegistry::instance().counter("bid.rejected");
+
+    if (result.status == BidStatus::Accepted || result.status == BidStatus::Buyout)
+    {
+        acceptedCount.fetch_add(1, std::memory_order_relaxed);
+        accepted.increment();
+    }
+    else
+    {
+        rejectedCount.fetch_add(1, std::memory_order_relaxed);
+        rejected.increment();
+    }
+    if (result.request.submittedNs != 0)
+    {
+        latency.record(static_cast<uint64_t>(MetricsRegistry::nowNs() - result.request.submittedNs));
+    }
+
+    if (resultCallback)
+    {
+        resultCallback(result);
+    }
+}
+
+void BidEngine::finish(size_t count)
+{
+    if (count > 0 && inFlight.fetch_sub(count, std::memory_order_acq_rel) == count)
+    {
+        std::scoped_lock lock(drainMutex);
+        drainCondition.notify_all();
+    }
+}
@@ -0,0 +1,421 @@
+#include "../../include/services/ClientDuplicateIndex.h"
+#include "../../include/core/MemoryUsage.h"
+#include "../../include/core/ThreadPool.h"
+#include <algorithm>
+#include <limits>
+#include <ranges>
+
+namespace
+{
+constexpr char32_t CYRILLIC_UPPER_A = U'А';
+constexpr char32_t CYRILLIC_UPPER_YA = U'Я';
+constexpr char32_t CYRILLIC_LOWER_A = U'а';
+constexpr char32_t CYRILLIC_LOWER_YA = U'я';
+constexpr char32_t CYRILLIC_CASE_OFFSET = CYRILLIC_LOWER_A - CYRILLIC_UPPER_A;
+constexpr char32_t CYRILLIC_UPPER_YO = U'Ё';
+constexpr char32_t CYRILLIC_LOWER_YO = U'ё';
+constexpr char32_t REPLACEMENT = U'\uFFFD';
+constexpr double EMAIL_LOCAL_WEIGHT = 0.2;
+constexpr double EMAIL_DOMAIN_WEIGHT = 0.15;
+
+struct Digraph
+{
+    std::string_view latin;
+    std::u32string_view cyrillic;
+};
+
+constexpr Digraph DIGRAPHS[] = {{"shch", U"щ"}, {"sh", U"ш"}, {"ch", U"ч"}, {"zh", U"ж"}, {"kh", U"х"},
+                                {"ts", U"ц"},   {"ya", U"я"}, {"yu", U"ю"}, {"yo", U"е"}};
+
+constexpr std::u32string_view LATIN_LETTERS[] = {U"а", U"б", U"к", U"д", U"е", U"ф", U"г", U"х", U"и",
+                                                 U"й", U"к", U"л", U"м", U"н", U"о", U"п", U"к", U"р",
+                                                 U"с", U"т", U"у", U"в", U"в", U"кс", U"и", U"з"};
+
+std::u32string decodeUtf8(std::string_view text)
+{
+    std::u32string result;
+    result.reserve(text.size());
+    for (size_t i = 0; i < text.size();)
+    {
+        auto lead = static_cast<unsigned char>(text[i]);
+        size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+        if (length == 0 || i + length > text.size())
+        {
+            result.push_back(REPLACEMENT);
+            ++i;
+            continue;
+        }
+        char32_t code = length == 1 ? lead : lead & (0x7F >> length);
+        bool valid = true;
+        for (size_t k = 1; k < length; ++k)
+        {
+            auto next = static_cast<unsigned char>(text[i + k]);
+            valid = valid && (next & 0xC0) == 0x80;
+            code = (code << 6) | (next & 0x3F);
+        }
+        result.push_back(valid ? code : REPLACEMENT);
+        i += valid ? length : 1;
+    }
+    return result;
+}
+
+char32_t toLower(char32_t c)
+{
+    if (c >= U'A' && c <= U'Z')
+    {
+        return c - U'A' + U'a';
+    }
+    if (c >= CYRILLIC_UPPER_A && c <= CYRILLIC_UPPER_YA)
+    {
+        return c + CYRILLIC_CASE_OFFSET;
+    }
+    if (c == CYRILLIC_UPPER_YO || c == CYRILLIC_LOWER_YO)
+    {
+        return U'е';
+    }
+    return c;
+}
+
+bool isLatin(char32_t c) { return c >= U'a' && c <= U'z'; }
+
+bool isCyrillic(char32_t c) { return c >= CYRILLIC_LOWER_A && c <= CYRILLIC_LOWER_YA; }
+
+size_t transliterate(std::u32string_view text, size_t pos, std::u32string &out)
+{
+    for (const Digraph &digraph : DIGRAPHS)
+    {
+        if (pos + digraph.latin.size() <= text.size() &&
+            std::ranges::equal(digraph.latin, text.substr(pos, digraph.latin.size()),
+                               [](char a, char32_t b) { return static_cast<char32_t>(a) == b; }))
+        {
+            out += digraph.cyrillic;
+            return digraph.latin.size();
+        }
+    }
+    out += LATIN_LETTERS[text[pos] - U'a'];
+    return 1;
+}
+
+char phoneticClass(char32_t c)
+{
+    switch (c)
+    {
+    case U'б':
+    case U'п':
+        return 'p';
+    case U'в':
+    case U'ф':
+        return 'f';
+    case U'г':
+    case U'к':
+    case U'х':
+        return 'k';
+    case U'д':
+    case U'т':
+        return 't';
+    case U'ж':
+    case U'ш':
+    case U'щ':
+    case U'ч':
+        return 'x';
+    case U'з':
+    case U'с':
+    case U'ц':
+        return 's';
+    case U'л':
+        return 'l';
+    case U'м':
+        return 'm';
+    case U'н':
+        return 'n';
+    case U'р':
+        return 'r';
+    default:
+        return 0;
+    }
+}
+
+std::string lowerAscii(std::string_view text)
+{
+    std::string result(text);
+    std::ranges::transform(result, result.begin(), [](char c) { return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c; });
+    return result;
+}
+} 
+
+std::u32string ClientDuplicateIndex::normalizeName(std::string_view name)
+{
+    std::u32string text = decodeUtf8(name);
+    std::ranges::transform(text, text.begin(), toLower);
+
+    std::vector<std::u32string> tokens;
+    std::u32string token;
+    for (size_t i = 0; i <= text.size();)
+    {
+        if (i < text.size() && isLatin(text[i]))
+        {
+            i += transliterate(text, i, token);
+            continue;
+        }
+        if (i < text.size() && isCyrillic(text[i]))
+        {
+            token.push_back(text[i++]);
+            continue;
+        }
+        if (!token.empty())
+        {
+            tokens.push_back(std::move(token));
+            token.clear();
+        }
+        ++i;
+    }
+
+    std::ranges::sort(tokens);
+    std::u32string result;
+    for (const auto &part : tokens)
+    {
+        if (!result.empty())
+        {
+            result.push_back(U' ');
+        }
+        result += part;
+    }
+    return result;
+}
+
+std::string ClientDuplicateIndex::phoneticKey(std::u32string_view normalizedName)
+{
+    std::string key;
+    size_t tokenLength = 0;
+    char last = 0;
+    for (size_t i = 0; i < normalizedName.size(); ++i)
+    {
+        char32_t c = normalizedName[i];
+        if (c == U' ')
+        {
+            key.push_back(' ');
+            tokenLength = 0;
+            last = 0;
+            continue;
+        }
+        char code = phoneticClass(c);
+        if (tokenLength == 0)
+        {
+            code = code != 0 ? code : 'a';
+        }
+        else if (code == 0 || code == last || tokenLength >= PHONETIC_KEY_LENGTH)
+        {
+            continue;
+        }
+        key.push_back(code);
+        last = code;
+        ++tokenLength;
+    }
+    return key;
+}
+
+size_t ClientDuplicateIndex::editDistance(std::u32string_view left, std::u32string_view right)
+{
+    if (left.size() < right.size())
+    {
+        std::swap(left, right);
+    }
+    std::vector<size_t> row(right.size() + 1);
+    for (size_t j = 0; j <= right.size(); ++j)
+    {
+        row[j] = j;
+    }
+    for (size_t i = 1; i <= left.size(); ++i)
+    {
+        size_t diagonal = row[0];
+        row[0] = i;
+        for (size_t j = 1; j <= right.size(); ++j)
+        {
+            size_t above = row[j];
+            row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (left[i - 1] == right[j - 1] ? 0 : 1)});
+            diagonal = above;
+        }
+    }
+    return row[right.size()];
+}
+
+ClientDuplicateIndex::Fingerprint ClientDuplicateIndex::makeFingerprint(const Client &client)
+{
+    Fingerprint fingerprint;
+    fingerprint.name = normalizeName(client.getName());
+    fingerprint.phone = client.getPhone();
+    std::string email = lowerAscii(client.getEmail());
+    if (size_t at = email.rfind('@'); at != std::string::npos)
+    {
+        fingerprint.emailDomain = email.substr(at + 1);
+        fingerprint.emailLocal = email.substr(0, std::min(at, email.find('+')));
+    }
+    return fingerprint;
+}
+
+std::vector<std::string> ClientDuplicateIndex::getBlockKeys(const Fingerprint &fingerprint)
+{
+    std::vector<std::string> keys;
+    if (!fingerprint.phone.empty())
+    {
+        keys.push_back("p" + fingerprint.phone);
+    }
+    if (std::string name = phoneticKey(fingerprint.name); !name.empty())
+    {
+        keys.push_back("n" + name);
+        if (!fingerprint.emailDomain.empty())
+        {
+            keys.push_back("e" + fingerprint.emailDomain + "|" + name);
+        }
+    }
+    return keys;
+}
+
+double ClientDuplicateIndex::score(const Fingerprint &left, const Fingerprint &right, double threshold)
+{
+    double contact = left.phone == right.phone ? PHONE_WEIGHT : 0.0;
+    if (!left.emailLocal.empty() && left.emailLocal == right.emailLocal)
+    {
+        contact += left.emailDomain == right.emailDomain ? EMAIL_WEIGHT : EMAIL_LOCAL_WEIGHT;
+    }
+    else if (!left.emailDomain.empty() && left.emailDomain == right.emailDomain)
+    {
+        contact += EMAIL_DOMAIN_WEIGHT;
+    }
+
+    size_t longest = std::max(left.name.size(), right.name.size());
+    if (longest == 0 || contact + NAME_WEIGHT < threshold)
+    {
+        return std::min(1.0, contact);
+    }
+    double similarity =
+        1.0 - static_cast<double>(editDistance(left.name, right.name)) / static_cast<double>(longest);
+    return std::min(1.0, contact + NAME_WEIGHT * similarity);
+}
+
+void ClientDuplicateIndex::rebuild(const std::vector<std::shared_ptr<Client>> &clients)
+{
+    fingerprints.assign(clients.size(), {});
+    std::vector<std::vector<std::string>> keys(clients.size());
+    ThreadPool::instance().parallelChunks(clients.size(),
+                                          [&](size_t, size_t begin, size_t end)
+                                          {
+                                              for (size_t row = begin; row < end; ++row)
+                                              {
+                                                  fingerprints[row] = makeFingerprint(*clients[row]);
+                                                  keys[row] = getBlockKeys(fingerprints[row]);
+                                              }
+                                          });
+
+    blocks.clear();
+    blocks.reserve(clients.size() * 2);
+    for (size_t row = 0; row < keys.size(); ++row)
+    {
+        for (auto &key : keys[row])
+        {
+            blocks[std::move(key)].push_back(static_cast<uint32_t>(row));
+        }
+    }
+}
+
+void ClientDuplicateIndex::add(const Client &client)
+{
+    auto row = static_cast<uint32_t>(fingerprints.size());
+    fingerprints.push_back(makeFingerprint(client));
+    for (auto &key : getBlockKeys(fingerprints.back()))
+    {
+        blocks[std::move(key)].push_back(row);
+    }
+}
+
+std::vector<DuplicateCandidate> ClientDuplicateIndex::findMatches(const Client &client, double threshold) const
+{
+    Fingerprint fingerprint = makeFingerprint(client);
+    std::vector<uint32_t> rows;
+    for (const auto &key : getBlockKeys(fingerprint))
+    {
+        if (auto it = blocks.find(key); it != blocks.end() && it->second.size() <= MAX_BLOCK_SIZE)
+        {
+            rows.insert(rows.end(), it->second.begin(), it->second.end());
+        }
+    }
+    std::ranges::sort(rows);
+    auto [first, last] = std::ranges::unique(rows);
+    rows.erase(first, last);
+
+    std::vector<DuplicateCandidate> matches;
+    for (uint32_t row : rows)
+    {
+        if (double value = score(fingerprint, fingerprints[row], threshold); value >= threshold)
+        {
+            matches.push_back({row, value});
+        }
+    }
+    std::ranges::sort(matches, std::greater<>(), &DuplicateCandidate::score);
+    return matches;
+}
+
+std::vector<DuplicateRowPair> ClientDuplicateIndex::findAllPairs(double threshold) const
+{
+    std::vector<const std::vector<uint32_t> *> candidates;
+    for (const auto &[key, rows] : blocks)
+    {
+        if (rows.size() > 1 && rows.size() <= MAX_BLOCK_SIZE)
+        {
+            candidates.push_back(&rows);
+        }
+    }
+
+    ThreadPool &pool = ThreadPool::instance();
+    std::vector<std::vector<DuplicateRowPair>> partial(pool.getChunkCount(candidates.size()));
+    pool.parallelChunks(candidates.size(),
+                        [&](size_t chunk, size_t begin, size_t end)
+                        {
+                            for (size_t b = begin; b < end; ++b)
+                            {
+                                const auto &rows = *candidates[b];
+                                for (size_t i = 0; i < rows.size(); ++i)
+                                {
+                                    for (size_t j = i + 1; j < rows.size(); ++j)
+                                    {
+                                        double value =
+                                            score(fingerprints[rows[i]], fingerprints[rows[j]], threshold);
+                                        if (value >= threshold)
+                                        {
+                                            partial[chunk].push_back({rows[i], rows[j], value});
+                                        }
+                                    }
+                                }
+                            }
+                        });
+
+    std::vector<DuplicateRowPair> pairs;
+    for (auto &part : partial)
+    {
+        pairs.insert(pairs.end(), part.begin(), part.end());
+    }
+    auto byRows = [](const DuplicateRowPair &left, const DuplicateRowPair &right)
+    { return std::pair(left.first, left.second) < std::pair(right.first, right.second); };
+    auto sameRows = [](const DuplicateRowPair &left, const DuplicateRowPair &right)
+    { return left.first == right.first && left.second == right.second; };
+    std::ranges::sort(pairs, byRows);
+    auto [first, last] = std::ranges::unique(pairs, sameRows);
+    pairs.erase(first, last);
+    std::ranges::stable_sort(pairs, std::greater<>(), &DuplicateRowPair::score);
+    return pairs;
+}
+
+size_t ClientDuplicateIndex::getMemoryBytes() const
+{
+    size_t bytes = Memory::vectorHeapBytes(fingerprints) + Memory::stringMapHeapBytes(blocks);
+    for (const auto &fingerprint : fingerprints)
+    {
+        bytes += fingerprint.name.capacity() * sizeof(char32_t) + Memory::stringHeapBytes(fingerprint.phone) +
+                 Memory::stringHeapBytes(fingerprint.emailLocal) + Memory::stringHeapBytes(fingerprint.emailDomain);
+    }
+    for (const auto &[key, rows] : blocks)
+    {
+        bytes += Memory::vectorHeapBytes(rows);
+    }
+    return bytes;
+}
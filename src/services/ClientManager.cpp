@@ -1,4 +1,7 @@
 #include "../../include/services/ClientManager.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/core/Utils.h"
 #include <algorithm>
 #include <cctype>
@@ -18,6 +21,12 @@ void ClientManager::addClient(std::shared_ptr<Client> client)
         throw ClientManagerException("Client with ID " + client->getId() + " already exists");
     }
     clients.push_back(client);
+    invalidateIdRows();
+    std::scoped_lock lock(duplicatesMutex);
+    if (duplicates)
+    {
+        duplicates->add(*client);
+    }
 }
 
 bool ClientManager::removeClient(const std::string &id)
@@ -27,6 +36,8 @@ bool ClientManager::removeClient(const std::string &id)
         removed.begin() != clients.end())
     {
         clients.erase(removed.begin(), clients.end());
+        invalidateIdRows();
+        invalidateDuplicates();
         return true;
     }
     return false;
@@ -34,53 +45,163 @@ bool ClientManager::removeClient(const std::string &id)
 
 Client *ClientManager::findClient(const std::string &id) const
 {
+    static Counter &hits = MetricsRegistry::instance().counter("client.lookup.hits");
+    static Counter &misses = MetricsRegistry::instance().counter("client.lookup.misses");
     if (auto it = std::ranges::find_if(clients,
                                        [&id](const std::shared_ptr<Client> &client) { return client->getId() == id; });
         it != clients.end())
     {
+        hits.increment();
         return it->get();
     }
+    misses.increment();
     return nullptr;
 }
 
-std::vector<Client *> ClientManager::getAllClients() const
+std::vector<Client *> ClientManager::searchByName(std::string_view name) const
+{
+    TRACE_SCOPE("ClientManager::searchByName");
+    METRIC_TIME_SCOPE("client.search_by_name.duration_ns");
+    std::string lowerName(name.data(), name.size());
+    std::ranges::transform(lowerName, lowerName.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    return ThreadPool::instance().collect<Client *>(
+        clients.size(),
+        [this, &lowerName](size_t begin, size_t end, std::vector<Client *> &result)
+        {
+            std::string clientName;
+            for (size_t i = begin; i < end; ++i)
+            {
+                clientName = clients[i]->getName();
+                std::ranges::transform(clientName, clientName.begin(),
+                                       [](unsigned char c) { return std::tolower(c); });
+                if (Utils::stringContains(clientName, lowerName))
+                {
+                    result.push_back(clients[i].get());
+                }
+            }
+        });
+}
+
+std::vector<Client *> ClientManager::searchByPhone(std::string_view phone) const
+{
+    TRACE_SCOPE("ClientManager::searchByPhone");
+    METRIC_TIME_SCOPE("client.search_by_phone.duration_ns");
+    return ThreadPool::instance().collect<Client *>(
+        clients.size(),
+        [this, phone](size_t begin, size_t end, std::vector<Client *> &result)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (clients[i]->getPhone() == phone)
+                {
+                    result.push_back(clients[i].get());
+                }
+            }
+        });
+}
+
+MemoryUsage ClientManager::getMemoryUsage() const
 {
-    std::vector<Client *> result;
-    result.reserve(clients.size());
+    MemoryUsage usage;
+    usage.objectCount = clients.size();
+    usage.objectBytes = clients.size() * (sizeof(Client) + Memory::SHARED_CONTROL_BLOCK_BYTES);
+    usage.indexBytes = Memory::vectorHeapBytes(clients);
+    {
+        std::scoped_lock lock(idRowsMutex);
+        if (idRows)
+        {
+            usage.indexBytes += Memory::stringMapHeapBytes(*idRows);
+        }
+    }
+    {
+        std::scoped_lock lock(duplicatesMutex);
+        if (duplicates)
+        {
+            usage.indexBytes += duplicates->getMemoryBytes();
+        }
+    }
+    usage.arenaBytes = arena ? arena->getReservedBytes() : 0;
     for (const auto &client : clients)
     {
-        result.push_back(client.get());
+        usage.stringBytes += client->getStringBytes();
     }
-    return result;
+    return usage;
 }
 
-std::vector<Client *> ClientManager::searchByName(std::string_view name) const
+void ClientManager::setClients(std::vector<std::shared_ptr<Client>> &&newClients, std::shared_ptr<EntityArena> newArena)
 {
-    std::vector<Client *> result;
-    std::string lowerName(name.data(), name.size());
-    std::ranges::transform(lowerName, lowerName.begin(), [](unsigned char c) { return std::tolower(c); });
+    clients = std::move(newClients);
+    arena = std::move(newArena);
+    invalidateIdRows();
+    invalidateDuplicates();
+}
 
-    for (const auto &client : clients)
+std::shared_ptr<const IdRows> ClientManager::getIdRows() const
+{
+    std::scoped_lock lock(idRowsMutex);
+    if (!idRows)
     {
-        std::string clientName = client->getName();
-        std::ranges::transform(clientName, clientName.begin(), [](unsigned char c) { return std::tolower(c); });
-        if (Utils::stringContains(clientName, lowerName))
+        auto rows = std::make_shared<IdRows>();
+        rows->reserve(clients.size());
+        for (size_t row = 0; row < clients.size(); ++row)
         {
-            result.push_back(client.get());
+            rows->try_emplace(clients[row]->getId(), static_cast<uint32_t>(row));
         }
+        idRows = std::move(rows);
     }
-    return result;
+    return idRows;
 }
 
-std::vector<Client *> ClientManager::searchByPhone(std::string_view phone) const
+void ClientManager::invalidateIdRows()
 {
-    std::vector<Client *> result;
-    for (const auto &client : clients)
+    std::scoped_lock lock(idRowsMutex);
+    idRows.reset();
+}
+
+void ClientManager::invalidateDuplicates()
+{
+    std::scoped_lock lock(duplicatesMutex);
+    duplicates.reset();
+}
+
+const ClientDuplicateIndex &ClientManager::getDuplicateIndex() const
+{
+    if (!duplicates)
+    {
+        TRACE_SCOPE("ClientManager::buildDuplicateIndex");
+        METRIC_TIME_SCOPE("client.duplicates.build_duration_ns");
+        duplicates = std::make_unique<ClientDuplicateIndex>();
+        duplicates->rebuild(clients);
+    }
+    return *duplicates;
+}
+
+std::vector<DuplicateMatch> ClientManager::findDuplicates(const Client &client, double threshold) const
+{
+    TRACE_SCOPE("ClientManager::findDuplicates");
+    METRIC_TIME_SCOPE("client.find_duplicates.duration_ns");
+    std::scoped_lock lock(duplicatesMutex);
+    std::vector<DuplicateMatch> matches;
+    for (const auto &candidate : getDuplicateIndex().findMatches(client, threshold))
     {
-        if (client->getPhone() == phone)
+        if (Client *other = clients[candidate.row].get(); other->getId() != client.getId())
         {
-            result.push_back(client.get());
+            matches.push_back({other, candidate.score});
         }
     }
-    return result;
+    return matches;
+}
+
+std::vector<DuplicatePair> ClientManager::findAllDuplicates(double threshold) const
+{
+    TRACE_SCOPE("ClientManager::findAllDuplicates");
+    METRIC_TIME_SCOPE("client.find_all_duplicates.duration_ns");
+    std::scoped_lock lock(duplicatesMutex);
+    std::vector<DuplicatePair> pairs;
+    for (const auto &pair : getDuplicateIndex().findAllPairs(threshold))
+    {
+        pairs.push_back({clients[pair.first].get(), clients[pair.second].get(), pair.score});
+    }
+    return pairs;
 }
@@ -0,0 +1,369 @@
+#include "../../include/services/ClientMatcher.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Tracing.h"
+#include "../../include/entities/CommercialProperty.h"
+#include "../../include/entities/House.h"
+#include <algorithm>
+#include <climits>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <string>
+
+namespace
+{
+constexpr uint32_t ANY_CITY = std::numeric_limits<uint32_t>::max();
+constexpr uint32_t ANY_KIND = std::numeric_limits<uint8_t>::max();
+constexpr unsigned CITY_SHIFT = 32;
+
+struct Listing
+{
+    int64_t price = 0;
+    double area = 0.0;
+    Symbol city{};
+    PropertyKind kind = PropertyKind::Apartment;
+    int rooms = 0;
+    bool parking = false;
+    bool available = false;
+
+    static Listing of(const Property &property)
+    {
+        return {property.getPrice().getKopecks(),
+                property.getArea(),
+                property.getCitySymbol(),
+                PropertyColumns::kindOf(property),
+                PropertyColumns::roomsOf(property),
+                SearchProfile::hasParking(property),
+                property.getIsAvailable()};
+    }
+};
+
+bool accepts(const SearchProfile &profile, const Listing &listing)
+{
+    return listing.available && (!profile.minPrice || listing.price >= profile.minPrice->getKopecks()) &&
+           (!profile.maxPrice || listing.price <= profile.maxPrice->getKopecks()) &&
+           (!profile.minArea || listing.area >= *profile.minArea) &&
+           (!profile.maxArea || listing.area <= *profile.maxArea) && (!profile.city || listing.city == *profile.city) &&
+           (!profile.kind || listing.kind == *profile.kind) &&
+           (!profile.minRooms || listing.rooms >= *profile.minRooms) &&
+           (!profile.maxRooms || listing.rooms <= *profile.maxRooms) && (!profile.needsParking || listing.parking);
+}
+
+uint64_t bucketKey(uint32_t city, uint32_t kind) { return (static_cast<uint64_t>(city) << CITY_SHIFT) | kind; }
+
+uint64_t bucketKey(const SearchProfile &profile)
+{
+    return bucketKey(profile.city ? static_cast<uint32_t>(*profile.city) : ANY_CITY,
+                     profile.kind ? static_cast<uint32_t>(*profile.kind) : ANY_KIND);
+}
+
+void validateProfile(const SearchProfile &profile)
+{
+    if (profile.clientId.empty())
+    {
+        throw ClientMatcherException("Invalid search profile: client ID is empty");
+    }
+    if (profile.minPrice && profile.maxPrice && *profile.minPrice > *profile.maxPrice)
+    {
+        throw ClientMatcherException("Invalid search profile: minimum price exceeds maximum");
+    }
+    if (profile.minArea && profile.maxArea && *profile.minArea > *profile.maxArea)
+    {
+        throw ClientMatcherException("Invalid search profile: minimum area exceeds maximum");
+    }
+    if (profile.minRooms && profile.maxRooms && *profile.minRooms > *profile.maxRooms)
+    {
+        throw ClientMatcherException("Invalid search profile: minimum rooms exceed maximum");
+    }
+}
+} 
+
+bool SearchProfile::matches(const Property &property) const { return accepts(*this, Listing::of(property)); }
+
+bool SearchProfile::hasParking(const Property &property)
+{
+    if (const auto *commercial = dynamic_cast<const CommercialProperty *>(&property))
+    {
+        return commercial->getHasParking();
+    }
+    if (const auto *house = dynamic_cast<const House *>(&property))
+    {
+        return house->getHasGarage();
+    }
+    return false;
+}
+
+uint32_t ClientMatcher::addProfile(SearchProfile profile)
+{
+    validateProfile(profile);
+    if (profile.id == 0)
+    {
+        profile.id = nextId;
+    }
+    else if (profileRows.contains(profile.id))
+    {
+        throw ClientMatcherException("Search profile with ID " + std::to_string(profile.id) + " already exists");
+    }
+    nextId = std::max(nextId, profile.id + 1);
+    profileRows[profile.id] = static_cast<uint32_t>(profiles.size());
+    profilesByClient[profile.clientId].push_back(profile.id);
+    profiles.push_back(std::move(profile));
+    removedRows.push_back(false);
+    return profiles.back().id;
+}
+
+bool ClientMatcher::removeProfile(uint32_t id)
+{
+    auto it = profileRows.find(id);
+    if (it == profileRows.end())
+    {
+        return false;
+    }
+    uint32_t row = it->second;
+    profileRows.erase(it);
+    if (auto owner = profilesByClient.find(profiles[row].clientId); owner != profilesByClient.end())
+    {
+        std::erase(owner->second, id);
+        if (owner->second.empty())
+        {
+            profilesByClient.erase(owner);
+        }
+    }
+    markRemoved(row);
+    compactIfNeeded();
+    return true;
+}
+
+size_t ClientMatcher::removeProfilesByClient(const std::string &clientId)
+{
+    auto owner = profilesByClient.extract(clientId);
+    if (owner.empty())
+    {
+        return 0;
+    }
+    for (uint32_t id : owner.mapped())
+    {
+        auto it = profileRows.find(id);
+        markRemoved(it->second);
+        profileRows.erase(it);
+    }
+    compactIfNeeded();
+    return owner.mapped().size();
+}
+
+void ClientMatcher::markRemoved(uint32_t row)
+{
+    removedRows[row] = true;
+    ++removedCount;
+}
+
+void ClientMatcher::compactIfNeeded()
+{
+    if (removedCount <= std::max(MIN_PENDING_PROFILES, profiles.size() / PENDING_FRACTION))
+    {
+        return;
+    }
+    TRACE_SCOPE("ClientMatcher::compact");
+    size_t kept = 0;
+    for (size_t row = 0; row < profiles.size(); ++row)
+    {
+        if (removedRows[row])
+        {
+            continue;
+        }
+        if (kept != row)
+        {
+            profiles[kept] = std::move(profiles[row]);
+        }
+        ++kept;
+    }
+    profiles.resize(kept);
+    rebuildRows();
+}
+
+const SearchProfile *ClientMatcher::findProfile(uint32_t id) const
+{
+    auto it = profileRows.find(id);
+    return it != profileRows.end() ? &profiles[it->second] : nullptr;
+}
+
+std::vector<const SearchProfile *> ClientMatcher::getProfilesByClient(const std::string &clientId) const
+{
+    std::vector<const SearchProfile *> result;
+    if (auto owner = profilesByClient.find(clientId); owner != profilesByClient.end())
+    {
+        for (uint32_t id : owner->second)
+        {
+            result.push_back(&profiles[profileRows.at(id)]);
+        }
+    }
+    return result;
+}
+
+std::vector<const SearchProfile *> ClientMatcher::getProfiles() const
+{
+    std::vector<const SearchProfile *> result;
+    result.reserve(getCount());
+    for (size_t row = 0; row < profiles.size(); ++row)
+    {
+        if (!removedRows[row])
+        {
+            result.push_back(&profiles[row]);
+        }
+    }
+    return result;
+}
+
+void ClientMatcher::rebuildRows()
+{
+    removedRows.assign(profiles.size(), false);
+    removedCount = 0;
+    profileRows.clear();
+    profileRows.reserve(profiles.size());
+    profilesByClient.clear();
+    for (size_t row = 0; row < profiles.size(); ++row)
+    {
+        profileRows[profiles[row].id] = static_cast<uint32_t>(row);
+        profilesByClient[profiles[row].clientId].push_back(profiles[row].id);
+    }
+    std::scoped_lock lock(indexMutex);
+    index.reset();
+}
+
+std::shared_ptr<const ClientMatcher::MatchIndex> ClientMatcher::getIndex() const
+{
+    std::scoped_lock lock(indexMutex);
+    if (index && profiles.size() - index->rows <= std::max(MIN_PENDING_PROFILES, index->rows / PENDING_FRACTION))
+    {
+        return index;
+    }
+
+    TRACE_SCOPE("ClientMatcher::buildIndex");
+    METRIC_TIME_SCOPE("matcher.build_index.duration_ns");
+    std::unordered_map<uint64_t, std::vector<IntervalTree<uint32_t>::Interval>> grouped;
+    for (size_t row = 0; row < profiles.size(); ++row)
+    {
+        if (removedRows[row])
+        {
+            continue;
+        }
+        const SearchProfile &profile = profiles[row];
+        grouped[bucketKey(profile)].push_back(
+            {profile.minPrice ? profile.minPrice->getKopecks() : std::numeric_limits<int64_t>::min(),
+             profile.maxPrice ? profile.maxPrice->getKopecks() : std::numeric_limits<int64_t>::max(),
+             static_cast<uint32_t>(row)});
+    }
+
+    std::vector<std::pair<uint64_t, std::vector<IntervalTree<uint32_t>::Interval>>> groups(
+        std::make_move_iterator(grouped.begin()), std::make_move_iterator(grouped.end()));
+    std::vector<IntervalTree<uint32_t>> trees(groups.size());
+    ThreadPool::instance().parallelFor(groups.size(), [&groups, &trees](size_t i)
+                                       { trees[i] = IntervalTree<uint32_t>(std::move(groups[i].second)); });
+
+    auto fresh = std::make_shared<MatchIndex>();
+    fresh->rows = profiles.size();
+    for (size_t i = 0; i < groups.size(); ++i)
+    {
+        fresh->buckets.emplace(groups[i].first, std::move(trees[i]));
+    }
+    index = std::move(fresh);
+    return index;
+}
+
+std::vector<const SearchProfile *> ClientMatcher::match(const Property &property) const
+{
+    TRACE_SCOPE("ClientMatcher::match");
+    METRIC_TIME_SCOPE("matcher.match.duration_ns");
+    static Counter &matches = MetricsRegistry::instance().counter("matcher.matches");
+    std::vector<const SearchProfile *> result;
+    Listing listing = Listing::of(property);
+    if (!listing.available)
+    {
+        return result;
+    }
+
+    auto current = getIndex();
+    auto collect = [this, &listing, &result](uint32_t row)
+    {
+        if (accepts(profiles[row], listing) && !removedRows[row])
+        {
+            result.push_back(&profiles[row]);
+        }
+    };
+    for (uint32_t city : {static_cast<uint32_t>(listing.city), ANY_CITY})
+    {
+        for (uint32_t kind : {static_cast<uint32_t>(listing.kind), ANY_KIND})
+        {
+            if (auto it = current->buckets.find(bucketKey(city, kind)); it != current->buckets.end())
+            {
+                it->second.stab(listing.price, collect);
+            }
+        }
+    }
+    for (size_t row = current->rows; row < profiles.size(); ++row)
+    {
+        collect(static_cast<uint32_t>(row));
+    }
+    matches.increment(result.size());
+    return result;
+}
+
+void ClientMatcher::notifyPropertyChanged(const Property &property) const
+{
+    if (matchCallback)
+    {
+        matchCallback(property, match(property));
+    }
+}
+
+void ClientMatcher::setProfiles(std::vector<SearchProfile> &&newProfiles)
+{
+    profiles = std::move(newProfiles);
+    nextId = 1;
+    for (const auto &profile : profiles)
+    {
+        nextId = std::max(nextId, profile.id + 1);
+    }
+    for (auto &profile : profiles)
+    {
+        if (profile.id == 0)
+        {
+            profile.id = nextId++;
+        }
+    }
+    std::ranges::sort(profiles,
+                      [](const SearchProfile &left, const SearchProfile &right)
+                      {
+                          return std::pair(bucketKey(left), left.minPrice.value_or(Money())) <
+                                 std::pair(bucketKey(right), right.minPrice.value_or(Money()));
+                      });
+    rebuildRows();
+}
+
+MemoryUsage ClientMatcher::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objectCount = getCount();
+    usage.objectBytes = Memory::vectorHeapBytes(profiles) + removedRows.capacity() / CHAR_BIT;
+    usage.indexBytes = profileRows.bucket_count() * sizeof(void *) +
+                       profileRows.size() * (Memory::HASH_NODE_OVERHEAD + sizeof(std::pair<uint32_t, uint32_t>)) +
+                       Memory::stringMapHeapBytes(profilesByClient);
+    for (const auto &[clientId, ids] : profilesByClient)
+    {
+        usage.indexBytes += Memory::vectorHeapBytes(ids);
+    }
+    for (const auto &profile : profiles)
+    {
+        usage.stringBytes += Memory::stringHeapBytes(profile.clientId);
+    }
+    std::scoped_lock lock(indexMutex);
+    if (index)
+    {
+        for (const auto &[key, tree] : index->buckets)
+        {
+            usage.indexBytes += Memory::HASH_NODE_OVERHEAD + sizeof(key) + sizeof(tree) + tree.getMemoryBytes();
+        }
+    }
+    return usage;
+}
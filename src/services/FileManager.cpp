@@ -1,20 +1,63 @@
 #include "../../include/services/FileManager.h"
 #include "../../include/core/Constants.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
+#include "../../include/core/Utils.h"
 #include "../../include/entities/PropertyParams.h"
 #include <fstream>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string_view>
 
+namespace
+{
+Money parseMoney(std::string_view field)
+{
+    auto value = Money::parse(field);
+    if (!value)
+    {
+        throw std::invalid_argument("Invalid money value: " + std::string(field));
+    }
+    return *value;
+}
+
+PropertyKind parsePropertyKind(const std::string &field)
+{
+    int value = std::stoi(field);
+    if (value < static_cast<int>(PropertyKind::Apartment) || value > static_cast<int>(PropertyKind::Commercial))
+    {
+        throw std::out_of_range("Invalid property kind: " + field);
+    }
+    return static_cast<PropertyKind>(value);
+}
+
+template <typename T> void writeOptional(std::ostream &out, const std::optional<T> &value)
+{
+    if (value)
+    {
+        out << *value;
+    }
+}
+
+template <typename T, typename Parse> std::optional<T> readOptional(const std::string &field, Parse &&parse)
+{
+    return field.empty() ? std::nullopt : std::optional<T>(parse(field));
+}
+} 
+
 void FileManager::saveProperties(const PropertyManager &manager, const std::string &filename)
 {
-    const auto &properties = manager.getProperties();
+    TRACE_SCOPE("FileManager::saveProperties");
+    METRIC_TIME_SCOPE("file.save_properties.duration_ns");
+    auto properties = manager.getAllProperties();
     std::ofstream file(filename);
     if (!file.is_open())
     {
         throw FileManagerException("Cannot open file for writing: " + filename);
     }
 
-    for (const auto &prop : properties)
+    for (const Property *prop : properties)
     {
         file << prop->toFileString() << "\n";
     }
@@ -23,7 +66,10 @@ void FileManager::saveProperties(const PropertyManager &manager, const std::stri
 
 void FileManager::loadProperties(PropertyManager &manager, const std::string &filename)
 {
-    std::vector<std::unique_ptr<Property>> properties;
+    TRACE_SCOPE("FileManager::loadProperties");
+    METRIC_TIME_SCOPE("file.load_properties.duration_ns");
+    auto arena = std::make_shared<EntityArena>();
+    std::vector<PropertyPtr> properties;
     std::ifstream file(filename);
     if (!file.is_open())
     {
@@ -54,7 +100,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::string house;
                 std::string desc;
                 std::string avail;
-                double price;
+                std::string priceStr;
                 double area;
                 int rooms;
                 int floor;
@@ -65,8 +111,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::getline(iss, city, FILE_DELIMITER);
                 std::getline(iss, street, FILE_DELIMITER);
                 std::getline(iss, house, FILE_DELIMITER);
-                iss >> price;
-                iss.ignore();
+                std::getline(iss, priceStr, FILE_DELIMITER);
                 iss >> area;
                 iss.ignore();
                 std::getline(iss, desc, FILE_DELIMITER);
@@ -79,9 +124,12 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 iss.ignore();
                 iss >> elevator;
 
-                ApartmentParams params{
-                    {id, city, street, house, price, area, desc}, rooms, floor, balcony == 1, elevator == 1};
-                auto apartment = std::make_unique<Apartment>(params);
+                ApartmentParams params{{id, city, street, house, parseMoney(priceStr), area, desc},
+                                       rooms,
+                                       floor,
+                                       balcony == 1,
+                                       elevator == 1};
+                auto apartment = arena->makeUnique<Apartment>(params);
                 apartment->setAvailable(avail == std::string(1, AVAILABLE_CHAR));
                 properties.push_back(std::move(apartment));
             }
@@ -93,7 +141,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::string house;
                 std::string desc;
                 std::string avail;
-                double price;
+                std::string priceStr;
                 double area;
                 double landArea;
                 int floors;
@@ -105,8 +153,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::getline(iss, city, FILE_DELIMITER);
                 std::getline(iss, street, FILE_DELIMITER);
                 std::getline(iss, house, FILE_DELIMITER);
-                iss >> price;
-                iss.ignore();
+                std::getline(iss, priceStr, FILE_DELIMITER);
                 iss >> area;
                 iss.ignore();
                 std::getline(iss, desc, FILE_DELIMITER);
@@ -121,9 +168,13 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 iss.ignore();
                 iss >> garden;
 
-                HouseParams params{
-                    {id, city, street, house, price, area, desc}, floors, rooms, landArea, garage == 1, garden == 1};
-                auto houseObj = std::make_unique<House>(params);
+                HouseParams params{{id, city, street, house, parseMoney(priceStr), area, desc},
+                                   floors,
+                                   rooms,
+                                   landArea,
+                                   garage == 1,
+                                   garden == 1};
+                auto houseObj = arena->makeUnique<House>(params);
                 houseObj->setAvailable(avail == std::string(1, AVAILABLE_CHAR));
                 properties.push_back(std::move(houseObj));
             }
@@ -136,7 +187,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::string desc;
                 std::string avail;
                 std::string businessType;
-                double price;
+                std::string priceStr;
                 double area;
                 int parking;
                 int visible;
@@ -146,8 +197,7 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 std::getline(iss, city, FILE_DELIMITER);
                 std::getline(iss, street, FILE_DELIMITER);
                 std::getline(iss, house, FILE_DELIMITER);
-                iss >> price;
-                iss.ignore();
+                std::getline(iss, priceStr, FILE_DELIMITER);
                 iss >> area;
                 iss.ignore();
                 std::getline(iss, desc, FILE_DELIMITER);
@@ -159,12 +209,12 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
                 iss.ignore();
                 iss >> visible;
 
-                CommercialPropertyParams params{{id, city, street, house, price, area, desc},
+                CommercialPropertyParams params{{id, city, street, house, parseMoney(priceStr), area, desc},
                                                 businessType,
                                                 parking == 1,
                                                 parkingSpaces,
                                                 visible == 1};
-                auto commercial = std::make_unique<CommercialProperty>(params);
+                auto commercial = arena->makeUnique<CommercialProperty>(params);
                 commercial->setAvailable(avail == std::string(1, AVAILABLE_CHAR));
                 properties.push_back(std::move(commercial));
             }
@@ -180,19 +230,21 @@ void FileManager::loadProperties(PropertyManager &manager, const std::string &fi
     }
 
     file.close();
-    manager.setProperties(std::move(properties));
+    manager.setProperties(std::move(properties), std::move(arena));
 }
 
 void FileManager::saveClients(const ClientManager &manager, const std::string &filename)
 {
-    const auto &clients = manager.getClients();
+    TRACE_SCOPE("FileManager::saveClients");
+    METRIC_TIME_SCOPE("file.save_clients.duration_ns");
+    auto clients = manager.getAllClients();
     std::ofstream file(filename);
     if (!file.is_open())
     {
         throw FileManagerException("Cannot open file for writing: " + filename);
     }
 
-    for (const auto &client : clients)
+    for (const Client *client : clients)
     {
         file << client->getId() << FILE_DELIMITER << client->getName() << FILE_DELIMITER << client->getPhone()
              << FILE_DELIMITER << client->getEmail() << FILE_DELIMITER << client->getRegistrationDate() << "\n";
@@ -202,6 +254,9 @@ void FileManager::saveClients(const ClientManager &manager, const std::string &f
 
 void FileManager::loadClients(ClientManager &manager, const std::string &filename)
 {
+    TRACE_SCOPE("FileManager::loadClients");
+    METRIC_TIME_SCOPE("file.load_clients.duration_ns");
+    auto arena = std::make_shared<EntityArena>();
     std::vector<std::shared_ptr<Client>> clients;
     std::ifstream file(filename);
     if (!file.is_open())
@@ -234,7 +289,11 @@ void FileManager::loadClients(ClientManager &manager, const std::string &filenam
 
         try
         {
-            auto client = std::make_shared<Client>(id, name, phone, email);
+            auto client = arena->makeShared<Client>(id, name, phone, email);
+            if (!regDate.empty())
+            {
+                client->setRegistrationDate(regDate);
+            }
             clients.push_back(client);
         }
         catch (const std::invalid_argument &)
@@ -248,27 +307,35 @@ void FileManager::loadClients(ClientManager &manager, const std::string &filenam
     }
 
     file.close();
-    manager.setClients(std::move(clients));
+    manager.setClients(std::move(clients), std::move(arena));
 }
 
 void FileManager::saveTransactions(const TransactionManager &manager, const std::string &filename)
 {
-    const auto &transactions = manager.getTransactions();
+    TRACE_SCOPE("FileManager::saveTransactions");
+    METRIC_TIME_SCOPE("file.save_transactions.duration_ns");
+    auto transactions = manager.getAllTransactions();
     std::ofstream file(filename);
     if (!file.is_open())
     {
         throw FileManagerException("Cannot open file for writing: " + filename);
     }
 
-    for (const auto &trans : transactions)
+    for (const Transaction *trans : transactions)
     {
-        file << trans->toFileString() << "\n";
+        if (trans != nullptr)
+        {
+            file << trans->toFileString() << "\n";
+        }
     }
     file.close();
 }
 
 void FileManager::loadTransactions(TransactionManager &manager, const std::string &filename)
 {
+    TRACE_SCOPE("FileManager::loadTransactions");
+    METRIC_TIME_SCOPE("file.load_transactions.duration_ns");
+    auto arena = std::make_shared<EntityArena>();
     std::vector<std::shared_ptr<Transaction>> transactions;
     std::ifstream file(filename);
     if (!file.is_open())
@@ -293,20 +360,24 @@ void FileManager::loadTransactions(TransactionManager &manager, const std::strin
         std::string date;
         std::string status;
         std::string notes;
-        double finalPrice;
+        std::string finalPriceStr;
 
         std::getline(iss, id, FILE_DELIMITER);
         std::getline(iss, propertyId, FILE_DELIMITER);
         std::getline(iss, clientId, FILE_DELIMITER);
         std::getline(iss, date, FILE_DELIMITER);
-        iss >> finalPrice;
-        iss.ignore();
+        std::getline(iss, finalPriceStr, FILE_DELIMITER);
         std::getline(iss, status, FILE_DELIMITER);
         std::getline(iss, notes, FILE_DELIMITER);
 
         try
         {
-            auto transaction = std::make_shared<Transaction>(id, propertyId, clientId, finalPrice, status, notes);
+            auto transaction =
+                arena->makeShared<Transaction>(id, propertyId, clientId, parseMoney(finalPriceStr), status, notes);
+            if (!date.empty())
+            {
+                transaction->setDate(date);
+            }
             transactions.push_back(transaction);
         }
         catch (const std::invalid_argument &)
@@ -320,20 +391,26 @@ void FileManager::loadTransactions(TransactionManager &manager, const std::strin
     }
 
     file.close();
-    manager.setTransactions(std::move(transactions));
+    manager.setTransactions(std::move(transactions), std::move(arena));
 }
 
 void FileManager::saveAuctions(const AuctionManager &manager, const std::string &filename)
 {
-    const auto &auctions = manager.getAuctions();
+    TRACE_SCOPE("FileManager::saveAuctions");
+    METRIC_TIME_SCOPE("file.save_auctions.duration_ns");
+    auto auctions = manager.getAllAuctions();
     std::ofstream file(filename);
     if (!file.is_open())
     {
         throw FileManagerException("Cannot open file for writing: " + filename);
     }
 
-    for (const auto &auction : auctions)
+    for (const Auction *auction : auctions)
     {
+        if (auction == nullptr)
+        {
+            continue;
+        }
         file << auction->toFileString() << "\n";
 
         auto bids = auction->getBids();
@@ -345,7 +422,7 @@ void FileManager::saveAuctions(const AuctionManager &manager, const std::string
     file.close();
 }
 
-void FileManager::parseBidLine(std::string_view line, Auction *currentAuction)
+void FileManager::parseBidLine(std::string_view line, Auction *currentAuction, EntityArena &arena)
 {
     if (currentAuction == nullptr)
     {
@@ -380,13 +457,13 @@ void FileManager::parseBidLine(std::string_view line, Auction *currentAuction)
         }
         std::getline(iss, timestamp, FILE_DELIMITER);
 
-        double amount = std::stod(amountStr);
-        if (amount <= 0.0)
+        Money amount = parseMoney(amountStr);
+        if (!amount.isPositive())
         {
             return;
         }
 
-        auto bid = std::make_shared<Bid>(clientId, clientName, amount);
+        auto bid = arena.makeShared<Bid>(clientId, clientName, amount);
         currentAuction->addBidDirect(bid);
     }
     catch (const std::invalid_argument &e)
@@ -399,7 +476,7 @@ void FileManager::parseBidLine(std::string_view line, Auction *currentAuction)
     }
 }
 
-std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line)
+std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line, EntityArena &arena)
 {
     std::string lineStr(line);
     std::istringstream iss(lineStr);
@@ -411,6 +488,7 @@ std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line)
     std::string status;
     std::string createdAt;
     std::string completedAt;
+    std::string endsAt;
 
     std::getline(iss, id, FILE_DELIMITER);
     std::getline(iss, propertyId, FILE_DELIMITER);
@@ -420,11 +498,20 @@ std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line)
     std::getline(iss, status, FILE_DELIMITER);
     std::getline(iss, createdAt, FILE_DELIMITER);
     std::getline(iss, completedAt, FILE_DELIMITER);
+    std::getline(iss, endsAt, FILE_DELIMITER);
 
     try
     {
-        double startingPrice = std::stod(startingPriceStr);
-        auto auction = std::make_shared<Auction>(id, propertyId, propertyAddress, startingPrice);
+        Money startingPrice = parseMoney(startingPriceStr);
+        auto auction = arena.makeShared<Auction>(id, propertyId, propertyAddress, startingPrice);
+
+        if (!endsAt.empty())
+        {
+            if (auto endTime = Utils::parseTime(endsAt); endTime)
+            {
+                auction->setEndTime(*endTime);
+            }
+        }
 
         if (status == Constants::AuctionStatus::COMPLETED)
         {
@@ -434,6 +521,10 @@ std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line)
         {
             auction->cancel();
         }
+        if (!createdAt.empty())
+        {
+            auction->setTimestamps(createdAt, completedAt.empty() ? auction->getCompletedAt() : completedAt);
+        }
         return auction;
     }
     catch (const std::invalid_argument &e)
@@ -450,6 +541,9 @@ std::shared_ptr<Auction> FileManager::parseAuctionLine(std::string_view line)
 
 void FileManager::loadAuctions(AuctionManager &manager, const std::string &filename)
 {
+    TRACE_SCOPE("FileManager::loadAuctions");
+    METRIC_TIME_SCOPE("file.load_auctions.duration_ns");
+    auto arena = std::make_shared<EntityArena>();
     std::vector<std::shared_ptr<Auction>> auctions;
     std::ifstream file(filename);
     if (!file.is_open())
@@ -471,11 +565,11 @@ void FileManager::loadAuctions(AuctionManager &manager, const std::string &filen
 
         if (line.starts_with(BID_PREFIX))
         {
-            parseBidLine(line, currentAuction);
+            parseBidLine(line, currentAuction, *arena);
         }
         else
         {
-            auto auction = parseAuctionLine(line);
+            auto auction = parseAuctionLine(line, *arena);
             if (auction != nullptr)
             {
                 auctions.push_back(auction);
@@ -485,5 +579,198 @@ void FileManager::loadAuctions(AuctionManager &manager, const std::string &filen
     }
 
     file.close();
-    manager.setAuctions(std::move(auctions));
+    manager.setAuctions(std::move(auctions), std::move(arena));
+}
+
+void FileManager::savePriceHistory(const PropertyManager &manager, const std::string &filename)
+{
+    TRACE_SCOPE("FileManager::savePriceHistory");
+    METRIC_TIME_SCOPE("file.save_price_history.duration_ns");
+    const PriceHistory &history = manager.getPriceHistory();
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        throw FileManagerException("Cannot open file for writing: " + filename);
+    }
+
+    for (const auto &id : history.getPropertyIds())
+    {
+        file << id;
+        for (const auto &point : history.getHistory(id))
+        {
+            file << FILE_DELIMITER << point.time << FILE_DELIMITER << point.price;
+        }
+        file << "\n";
+    }
+    file.close();
+}
+
+void FileManager::loadPriceHistory(PropertyManager &manager, const std::string &filename)
+{
+    TRACE_SCOPE("FileManager::loadPriceHistory");
+    METRIC_TIME_SCOPE("file.load_price_history.duration_ns");
+    PriceHistory history;
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::istringstream iss(line);
+        std::string id;
+        std::string timeStr;
+        std::string priceStr;
+        std::getline(iss, id, FILE_DELIMITER);
+
+        try
+        {
+            while (std::getline(iss, timeStr, FILE_DELIMITER) && std::getline(iss, priceStr, FILE_DELIMITER))
+            {
+                history.record(id, static_cast<std::time_t>(std::stoll(timeStr)), parseMoney(priceStr));
+            }
+        }
+        catch (const std::invalid_argument &)
+        {
+            continue;
+        }
+        catch (const std::out_of_range &)
+        {
+            continue;
+        }
+    }
+
+    file.close();
+    manager.setPriceHistory(std::move(history));
+}
+
+void FileManager::saveSearchProfiles(const ClientMatcher &matcher, const std::string &filename)
+{
+    TRACE_SCOPE("FileManager::saveSearchProfiles");
+    METRIC_TIME_SCOPE("file.save_search_profiles.duration_ns");
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        throw FileManagerException("Cannot open file for writing: " + filename);
+    }
+
+    const StringPool &pool = StringPool::instance();
+    for (const SearchProfile *entry : matcher.getProfiles())
+    {
+        const SearchProfile &profile = *entry;
+        file << profile.id << FILE_DELIMITER << profile.clientId << FILE_DELIMITER;
+        writeOptional(file, profile.minPrice);
+        file << FILE_DELIMITER;
+        writeOptional(file, profile.maxPrice);
+        file << FILE_DELIMITER;
+        writeOptional(file, profile.minArea);
+        file << FILE_DELIMITER;
+        writeOptional(file, profile.maxArea);
+        file << FILE_DELIMITER;
+        if (profile.city)
+        {
+            file << pool.resolve(*profile.city);
+        }
+        file << FILE_DELIMITER;
+        if (profile.kind)
+        {
+            file << static_cast<int>(*profile.kind);
+        }
+        file << FILE_DELIMITER;
+        writeOptional(file, profile.minRooms);
+        file << FILE_DELIMITER;
+        writeOptional(file, profile.maxRooms);
+        file << FILE_DELIMITER << (profile.needsParking ? AVAILABLE_CHAR : UNAVAILABLE_CHAR) << "\n";
+    }
+    file.close();
+}
+
+void FileManager::loadSearchProfiles(ClientMatcher &matcher, const std::string &filename)
+{
+    TRACE_SCOPE("FileManager::loadSearchProfiles");
+    METRIC_TIME_SCOPE("file.load_search_profiles.duration_ns");
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    matcher.setProfiles({});
+
+    auto toInt = [](const std::string &field) { return std::stoi(field); };
+    auto toDouble = [](const std::string &field) { return std::stod(field); };
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::istringstream iss(line);
+        std::string id;
+        std::string clientId;
+        std::string minPrice;
+        std::string maxPrice;
+        std::string minArea;
+        std::string maxArea;
+        std::string city;
+        std::string kind;
+        std::string minRooms;
+        std::string maxRooms;
+        std::string parking;
+
+        std::getline(iss, id, FILE_DELIMITER);
+        std::getline(iss, clientId, FILE_DELIMITER);
+        std::getline(iss, minPrice, FILE_DELIMITER);
+        std::getline(iss, maxPrice, FILE_DELIMITER);
+        std::getline(iss, minArea, FILE_DELIMITER);
+        std::getline(iss, maxArea, FILE_DELIMITER);
+        std::getline(iss, city, FILE_DELIMITER);
+        std::getline(iss, kind, FILE_DELIMITER);
+        std::getline(iss, minRooms, FILE_DELIMITER);
+        std::getline(iss, maxRooms, FILE_DELIMITER);
+        std::getline(iss, parking, FILE_DELIMITER);
+
+        try
+        {
+            SearchProfile profile;
+            profile.id = static_cast<uint32_t>(std::stoul(id));
+            profile.clientId = clientId;
+            profile.minPrice = readOptional<Money>(minPrice, parseMoney);
+            profile.maxPrice = readOptional<Money>(maxPrice, parseMoney);
+            profile.minArea = readOptional<double>(minArea, toDouble);
+            profile.maxArea = readOptional<double>(maxArea, toDouble);
+            if (!city.empty())
+            {
+                profile.city = StringPool::instance().intern(city);
+            }
+            profile.kind = readOptional<PropertyKind>(kind, parsePropertyKind);
+            profile.minRooms = readOptional<int>(minRooms, toInt);
+            profile.maxRooms = readOptional<int>(maxRooms, toInt);
+            profile.needsParking = parking == std::string(1, AVAILABLE_CHAR);
+            matcher.addProfile(std::move(profile));
+        }
+        catch (const std::invalid_argument &)
+        {
+            continue;
+        }
+        catch (const std::out_of_range &)
+        {
+            continue;
+        }
+        catch (const ClientMatcherException &)
+        {
+            continue;
+        }
+    }
+
+    file.close();
 }
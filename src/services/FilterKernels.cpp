@@ -0,0 +1,394 @@
+#include "../../include/services/FilterKernels.h"
+#include <algorithm>
+#include <cstdlib>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ESTATE_X86_KERNELS 1
+#endif
+
+namespace
+{
+constexpr size_t ROWS_PER_WORD = SelectionBitmap::BITS_PER_WORD;
+constexpr const char *ENVIRONMENT_VARIABLE = "ESTATE_SIMD";
+
+template <typename Predicate> void refineScalar(size_t begin, size_t count, uint64_t *bits, Predicate predicate)
+{
+    for (size_t w = begin / ROWS_PER_WORD; w * ROWS_PER_WORD < count; ++w)
+    {
+        size_t first = w * ROWS_PER_WORD;
+        size_t rows = std::min(ROWS_PER_WORD, count - first);
+        uint64_t word = 0;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            word |= static_cast<uint64_t>(predicate(first + i)) << i;
+        }
+        bits[w] &= word;
+    }
+}
+
+void int64RangeScalar(const int64_t *values, size_t count, int64_t low, int64_t high, uint64_t *bits)
+{
+    refineScalar(0, count, bits, [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+void doubleRangeScalar(const double *values, size_t count, double low, double high, uint64_t *bits)
+{
+    refineScalar(0, count, bits, [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+void byteEqualScalar(const uint8_t *values, size_t count, uint8_t wanted, uint64_t *bits)
+{
+    refineScalar(0, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+void symbolEqualScalar(const Symbol *values, size_t count, Symbol wanted, uint64_t *bits)
+{
+    refineScalar(0, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+void int32AtLeastScalar(const int32_t *values, size_t count, int32_t low, uint64_t *bits)
+{
+    refineScalar(0, count, bits, [=](size_t i) { return values[i] >= low; });
+}
+
+#ifdef ESTATE_X86_KERNELS
+__attribute__((target("avx2"))) void int64RangeAvx2(const int64_t *values, size_t count, int64_t low, int64_t high,
+                                                   uint64_t *bits)
+{
+    const __m256i lowVector = _mm256_set1_epi64x(low);
+    const __m256i highVector = _mm256_set1_epi64x(high);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const int64_t *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 4; ++k)
+        {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + k * 4));
+            __m256i outside =
+                _mm256_or_si256(_mm256_cmpgt_epi64(lowVector, value), _mm256_cmpgt_epi64(value, highVector));
+            auto rejected = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(outside)));
+            word |= (~rejected & 0xFU) << (k * 4);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits,
+                 [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+__attribute__((target("avx2"))) void doubleRangeAvx2(const double *values, size_t count, double low, double high,
+                                                    uint64_t *bits)
+{
+    const __m256d lowVector = _mm256_set1_pd(low);
+    const __m256d highVector = _mm256_set1_pd(high);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const double *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 4; ++k)
+        {
+            __m256d value = _mm256_loadu_pd(block + k * 4);
+            __m256d atLeastLow = _mm256_cmp_pd(value, lowVector, _CMP_GE_OQ);
+            __m256d atMostHigh = _mm256_cmp_pd(value, highVector, _CMP_LE_OQ);
+            __m256d inside = _mm256_and_pd(atLeastLow, atMostHigh);
+            word |= static_cast<uint64_t>(_mm256_movemask_pd(inside)) << (k * 4);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits,
+                 [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+__attribute__((target("avx2"))) void byteEqualAvx2(const uint8_t *values, size_t count, uint8_t wanted, uint64_t *bits)
+{
+    const __m256i wantedVector = _mm256_set1_epi8(static_cast<char>(wanted));
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const uint8_t *block = values + w * ROWS_PER_WORD;
+        __m256i lowHalf = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+        __m256i highHalf = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+        auto lowBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lowHalf, wantedVector)));
+        auto highBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(highHalf, wantedVector)));
+        bits[w] &= static_cast<uint64_t>(lowBits) | (static_cast<uint64_t>(highBits) << 32);
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+__attribute__((target("avx2"))) void symbolEqualAvx2(const Symbol *values, size_t count, Symbol wanted, uint64_t *bits)
+{
+    const __m256i wantedVector = _mm256_set1_epi32(static_cast<int>(wanted));
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const Symbol *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 8; ++k)
+        {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + k * 8));
+            __m256i equal = _mm256_cmpeq_epi32(value, wantedVector);
+            word |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal))) << (k * 8);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+__attribute__((target("avx2"))) void int32AtLeastAvx2(const int32_t *values, size_t count, int32_t low,
+                                                     uint64_t *bits)
+{
+    const __m256i lowVector = _mm256_set1_epi32(low);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const int32_t *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 8; ++k)
+        {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + k * 8));
+            __m256i below = _mm256_cmpgt_epi32(lowVector, value);
+            auto rejected = static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(below)));
+            word |= (~rejected & 0xFFU) << (k * 8);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] >= low; });
+}
+
+__attribute__((target("sse4.2"))) void int64RangeSse42(const int64_t *values, size_t count, int64_t low,
+                                                      int64_t high, uint64_t *bits)
+{
+    const __m128i lowVector = _mm_set1_epi64x(low);
+    const __m128i highVector = _mm_set1_epi64x(high);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const int64_t *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 2; ++k)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + k * 2));
+            __m128i outside = _mm_or_si128(_mm_cmpgt_epi64(lowVector, value), _mm_cmpgt_epi64(value, highVector));
+            auto rejected = static_cast<uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(outside)));
+            word |= (~rejected & 0x3U) << (k * 2);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits,
+                 [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+__attribute__((target("sse4.2"))) void doubleRangeSse42(const double *values, size_t count, double low, double high,
+                                                       uint64_t *bits)
+{
+    const __m128d lowVector = _mm_set1_pd(low);
+    const __m128d highVector = _mm_set1_pd(high);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const double *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 2; ++k)
+        {
+            __m128d value = _mm_loadu_pd(block + k * 2);
+            __m128d inside = _mm_and_pd(_mm_cmpge_pd(value, lowVector), _mm_cmple_pd(value, highVector));
+            word |= static_cast<uint64_t>(_mm_movemask_pd(inside)) << (k * 2);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits,
+                 [=](size_t i) { return values[i] >= low && values[i] <= high; });
+}
+
+__attribute__((target("sse4.2"))) void byteEqualSse42(const uint8_t *values, size_t count, uint8_t wanted,
+                                                     uint64_t *bits)
+{
+    const __m128i wantedVector = _mm_set1_epi8(static_cast<char>(wanted));
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const uint8_t *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 16; ++k)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + k * 16));
+            auto equal = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(value, wantedVector)));
+            word |= static_cast<uint64_t>(equal) << (k * 16);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+__attribute__((target("sse4.2"))) void symbolEqualSse42(const Symbol *values, size_t count, Symbol wanted,
+                                                       uint64_t *bits)
+{
+    const __m128i wantedVector = _mm_set1_epi32(static_cast<int>(wanted));
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const Symbol *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 4; ++k)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + k * 4));
+            __m128i equal = _mm_cmpeq_epi32(value, wantedVector);
+            word |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(equal))) << (k * 4);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] == wanted; });
+}
+
+__attribute__((target("sse4.2"))) void int32AtLeastSse42(const int32_t *values, size_t count, int32_t low,
+                                                        uint64_t *bits)
+{
+    const __m128i lowVector = _mm_set1_epi32(low);
+    size_t fullWords = count / ROWS_PER_WORD;
+    for (size_t w = 0; w < fullWords; ++w)
+    {
+        const int32_t *block = values + w * ROWS_PER_WORD;
+        uint64_t word = 0;
+        for (size_t k = 0; k < ROWS_PER_WORD / 4; ++k)
+        {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + k * 4));
+            __m128i below = _mm_cmpgt_epi32(lowVector, value);
+            auto rejected = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(below)));
+            word |= (~rejected & 0xFU) << (k * 4);
+        }
+        bits[w] &= word;
+    }
+    refineScalar(fullWords * ROWS_PER_WORD, count, bits, [=](size_t i) { return values[i] >= low; });
+}
+#endif
+
+constexpr FilterKernels SCALAR_KERNELS{SimdLevel::Scalar, int64RangeScalar, doubleRangeScalar,
+                                       byteEqualScalar,   symbolEqualScalar, int32AtLeastScalar};
+
+#ifdef ESTATE_X86_KERNELS
+constexpr FilterKernels SSE42_KERNELS{SimdLevel::Sse42, int64RangeSse42,  doubleRangeSse42,
+                                      byteEqualSse42,   symbolEqualSse42, int32AtLeastSse42};
+constexpr FilterKernels AVX2_KERNELS{SimdLevel::Avx2, int64RangeAvx2,  doubleRangeAvx2,
+                                     byteEqualAvx2,   symbolEqualAvx2, int32AtLeastAvx2};
+#endif
+
+const FilterKernels &chooseKernels()
+{
+    SimdLevel level = FilterKernels::detectLevel();
+    if (const char *value = std::getenv(ENVIRONMENT_VARIABLE); value != nullptr)
+    {
+        if (auto requested = FilterKernels::parseLevel(value);
+            requested && FilterKernels::isSupported(*requested) && *requested < level)
+        {
+            level = *requested;
+        }
+    }
+    return FilterKernels::forLevel(level);
+}
+} 
+
+void SelectionBitmap::reset(size_t rows)
+{
+    rowCount = rows;
+    words.assign((rows + BITS_PER_WORD - 1) / BITS_PER_WORD, ~uint64_t{0});
+    if (size_t tail = rows % BITS_PER_WORD; tail != 0)
+    {
+        words.back() = (uint64_t{1} << tail) - 1;
+    }
+}
+
+size_t SelectionBitmap::count() const
+{
+    size_t total = 0;
+    for (uint64_t word : words)
+    {
+        total += static_cast<size_t>(std::popcount(word));
+    }
+    return total;
+}
+
+size_t SelectionBitmap::findNext(size_t from) const
+{
+    size_t w = from / BITS_PER_WORD;
+    if (w >= words.size())
+    {
+        return rowCount;
+    }
+    uint64_t word = words[w] & (~uint64_t{0} << (from % BITS_PER_WORD));
+    while (word == 0)
+    {
+        if (++w == words.size())
+        {
+            return rowCount;
+        }
+        word = words[w];
+    }
+    return w * BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word));
+}
+
+SimdLevel FilterKernels::detectLevel()
+{
+#ifdef ESTATE_X86_KERNELS
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SimdLevel::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return SimdLevel::Sse42;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+bool FilterKernels::isSupported(SimdLevel level) { return level <= detectLevel(); }
+
+const FilterKernels &FilterKernels::forLevel(SimdLevel level)
+{
+#ifdef ESTATE_X86_KERNELS
+    if (level == SimdLevel::Avx2 && isSupported(SimdLevel::Avx2))
+    {
+        return AVX2_KERNELS;
+    }
+    if (level >= SimdLevel::Sse42 && isSupported(SimdLevel::Sse42))
+    {
+        return SSE42_KERNELS;
+    }
+#else
+    (void)level;
+#endif
+    return SCALAR_KERNELS;
+}
+
+const FilterKernels &FilterKernels::active()
+{
+    static const FilterKernels &kernels = chooseKernels();
+    return kernels;
+}
+
+const char *FilterKernels::getLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::Avx2:
+        return "avx2";
+    case SimdLevel::Sse42:
+        return "sse4.2";
+    default:
+        return "scalar";
+    }
+}
+
+std::optional<SimdLevel> FilterKernels::parseLevel(std::string_view name)
+{
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse42, SimdLevel::Avx2})
+    {
+        if (name == getLevelName(level))
+        {
+            return level;
+        }
+    }
+    return std::nullopt;
+}
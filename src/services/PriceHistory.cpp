@@ -0,0 +1,246 @@
+#include "../../include/services/PriceHistory.h"
+#include "../../include/core/MemoryUsage.h"
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace
+{
+constexpr size_t NEXT_OFFSET = 0;
+constexpr size_t USED_OFFSET = sizeof(uint32_t);
+constexpr size_t PAYLOAD_OFFSET = USED_OFFSET + 1;
+constexpr size_t PAYLOAD_BYTES = PriceHistory::BLOCK_BYTES - PAYLOAD_OFFSET;
+constexpr size_t MAX_VARINT_BYTES = 10;
+constexpr uint8_t VARINT_CONTINUE = 0x80;
+constexpr uint8_t VARINT_PAYLOAD = 0x7F;
+constexpr unsigned VARINT_SHIFT = 7;
+
+uint64_t zigzag(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+
+int64_t unzigzag(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+size_t encodeVarint(int64_t value, uint8_t *out)
+{
+    uint64_t bits = zigzag(value);
+    size_t length = 0;
+    while (bits >= VARINT_CONTINUE)
+    {
+        out[length++] = static_cast<uint8_t>(bits | VARINT_CONTINUE);
+        bits >>= VARINT_SHIFT;
+    }
+    out[length++] = static_cast<uint8_t>(bits);
+    return length;
+}
+
+int64_t decodeVarint(const uint8_t *&in)
+{
+    uint64_t bits = 0;
+    unsigned shift = 0;
+    while (*in & VARINT_CONTINUE)
+    {
+        bits |= static_cast<uint64_t>(*in++ & VARINT_PAYLOAD) << shift;
+        shift += VARINT_SHIFT;
+    }
+    bits |= static_cast<uint64_t>(*in++) << shift;
+    return unzigzag(bits);
+}
+
+uint32_t readNext(const uint8_t *block)
+{
+    uint32_t next = 0;
+    std::memcpy(&next, block + NEXT_OFFSET, sizeof(next));
+    return next;
+}
+
+void writeNext(uint8_t *block, uint32_t next) { std::memcpy(block + NEXT_OFFSET, &next, sizeof(next)); }
+
+bool inWindow(std::time_t time, std::time_t from, std::time_t to) { return time >= from && time <= to; }
+} 
+
+uint32_t PriceHistory::allocateBlock()
+{
+    if (!freeBlocks.empty())
+    {
+        uint32_t index = freeBlocks.back();
+        freeBlocks.pop_back();
+        uint8_t *block = blocks.data() + static_cast<size_t>(index) * BLOCK_BYTES;
+        writeNext(block, NO_BLOCK);
+        block[USED_OFFSET] = 0;
+        return index;
+    }
+    auto index = static_cast<uint32_t>(blocks.size() / BLOCK_BYTES);
+    blocks.resize(blocks.size() + BLOCK_BYTES);
+    uint8_t *block = blocks.data() + static_cast<size_t>(index) * BLOCK_BYTES;
+    writeNext(block, NO_BLOCK);
+    block[USED_OFFSET] = 0;
+    return index;
+}
+
+void PriceHistory::record(const std::string &propertyId, std::time_t time, Money price)
+{
+    auto [it, inserted] = series.try_emplace(propertyId);
+    Series &entry = it->second;
+    if (!inserted && entry.lastPrice == price.getKopecks())
+    {
+        return;
+    }
+
+    uint8_t encoded[2 * MAX_VARINT_BYTES];
+    size_t length = encodeVarint(static_cast<int64_t>(time) - entry.lastTime, encoded);
+    length += encodeVarint(price.getKopecks() - entry.lastPrice, encoded + length);
+
+    if (entry.lastBlock == NO_BLOCK)
+    {
+        entry.firstBlock = entry.lastBlock = allocateBlock();
+    }
+    else if (blocks[static_cast<size_t>(entry.lastBlock) * BLOCK_BYTES + USED_OFFSET] + length > PAYLOAD_BYTES)
+    {
+        uint32_t next = allocateBlock();
+        writeNext(blocks.data() + static_cast<size_t>(entry.lastBlock) * BLOCK_BYTES, next);
+        entry.lastBlock = next;
+    }
+
+    uint8_t *block = blocks.data() + static_cast<size_t>(entry.lastBlock) * BLOCK_BYTES;
+    std::memcpy(block + PAYLOAD_OFFSET + block[USED_OFFSET], encoded, length);
+    block[USED_OFFSET] = static_cast<uint8_t>(block[USED_OFFSET] + length);
+
+    entry.lastTime = static_cast<int64_t>(time);
+    entry.lastPrice = price.getKopecks();
+    ++entry.count;
+    ++pointCount;
+}
+
+size_t PriceHistory::erase(const std::string &propertyId)
+{
+    auto it = series.find(propertyId);
+    if (it == series.end())
+    {
+        return 0;
+    }
+    for (uint32_t index = it->second.firstBlock; index != NO_BLOCK;)
+    {
+        freeBlocks.push_back(index);
+        index = readNext(blocks.data() + static_cast<size_t>(index) * BLOCK_BYTES);
+    }
+    size_t erased = it->second.count;
+    pointCount -= erased;
+    series.erase(it);
+    return erased;
+}
+
+void PriceHistory::clear()
+{
+    blocks.clear();
+    series.clear();
+    freeBlocks.clear();
+    pointCount = 0;
+}
+
+void PriceHistory::visit(const Series &entry, const std::function<void(const PricePoint &)> &visitor) const
+{
+    int64_t time = 0;
+    int64_t price = 0;
+    for (uint32_t index = entry.firstBlock; index != NO_BLOCK;)
+    {
+        const uint8_t *block = blocks.data() + static_cast<size_t>(index) * BLOCK_BYTES;
+        const uint8_t *in = block + PAYLOAD_OFFSET;
+        const uint8_t *end = in + block[USED_OFFSET];
+        while (in < end)
+        {
+            time += decodeVarint(in);
+            price += decodeVarint(in);
+            visitor({static_cast<std::time_t>(time), Money::fromKopecks(price)});
+        }
+        index = readNext(block);
+    }
+}
+
+std::vector<std::string> PriceHistory::getPropertyIds() const
+{
+    std::vector<std::string> ids;
+    ids.reserve(series.size());
+    for (const auto &[id, entry] : series)
+    {
+        ids.push_back(id);
+    }
+    std::ranges::sort(ids);
+    return ids;
+}
+
+std::vector<PricePoint> PriceHistory::getHistory(const std::string &propertyId) const
+{
+    std::vector<PricePoint> points;
+    if (auto it = series.find(propertyId); it != series.end())
+    {
+        points.reserve(it->second.count);
+        visit(it->second, [&points](const PricePoint &point) { points.push_back(point); });
+    }
+    return points;
+}
+
+std::optional<Money> PriceHistory::getPriceAt(const std::string &propertyId, std::time_t time) const
+{
+    std::optional<Money> result;
+    if (auto it = series.find(propertyId); it != series.end())
+    {
+        visit(it->second,
+              [&result, time](const PricePoint &point)
+              {
+                  if (point.time <= time)
+                  {
+                      result = point.price;
+                  }
+              });
+    }
+    return result;
+}
+
+std::vector<PriceChange> PriceHistory::getChanges(const std::string &propertyId, std::time_t from,
+                                                  std::time_t to) const
+{
+    std::vector<PriceChange> changes;
+    if (auto it = series.find(propertyId); it != series.end())
+    {
+        std::optional<Money> previous;
+        visit(it->second,
+              [&](const PricePoint &point)
+              {
+                  if (previous && inWindow(point.time, from, to))
+                  {
+                      changes.push_back({propertyId, point.time, *previous, point.price});
+                  }
+                  previous = point.price;
+              });
+    }
+    return changes;
+}
+
+std::vector<PriceChange> PriceHistory::getChanges(std::time_t from, std::time_t to) const
+{
+    std::vector<PriceChange> changes;
+    for (const auto &[id, entry] : series)
+    {
+        if (entry.count < 2)
+        {
+            continue;
+        }
+        std::optional<Money> previous;
+        visit(entry,
+              [&](const PricePoint &point)
+              {
+                  if (previous && inWindow(point.time, from, to))
+                  {
+                      changes.push_back({id, point.time, *previous, point.price});
+                  }
+                  previous = point.price;
+              });
+    }
+    std::ranges::sort(changes, [](const PriceChange &left, const PriceChange &right)
+                      { return std::tie(left.time, left.propertyId) < std::tie(right.time, right.propertyId); });
+    return changes;
+}
+
+size_t PriceHistory::getMemoryBytes() const
+{
+    return Memory::vectorHeapBytes(blocks) + Memory::stringMapHeapBytes(series) + Memory::vectorHeapBytes(freeBlocks);
+}
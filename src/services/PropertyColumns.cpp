@@ -0,0 +1,171 @@
+#include "../../include/services/PropertyColumns.h"
+#include "../../include/entities/Apartment.h"
+#include "../../include/entities/CommercialProperty.h"
+#include "../../include/entities/House.h"
+#include <algorithm>
+#include <limits>
+
+PropertyKind PropertyColumns::kindOf(const Property &property)
+{
+    if (dynamic_cast<const Apartment *>(&property) != nullptr)
+    {
+        return PropertyKind::Apartment;
+    }
+    if (dynamic_cast<const House *>(&property) != nullptr)
+    {
+        return PropertyKind::House;
+    }
+    return PropertyKind::Commercial;
+}
+
+int PropertyColumns::roomsOf(const Property &property)
+{
+    if (const auto *apartment = dynamic_cast<const Apartment *>(&property))
+    {
+        return apartment->getRooms();
+    }
+    if (const auto *house = dynamic_cast<const House *>(&property))
+    {
+        return house->getRooms();
+    }
+    return 0;
+}
+
+void PropertyColumns::clear()
+{
+    prices.clear();
+    areas.clear();
+    available.clear();
+    kinds.clear();
+    cities.clear();
+    rooms.clear();
+}
+
+void PropertyColumns::reserve(size_t count)
+{
+    prices.reserve(count);
+    areas.reserve(count);
+    available.reserve(count);
+    kinds.reserve(count);
+    cities.reserve(count);
+    rooms.reserve(count);
+}
+
+void PropertyColumns::append(const Property &property)
+{
+    prices.push_back(property.getPrice().getKopecks());
+    areas.push_back(property.getArea());
+    available.push_back(property.getIsAvailable() ? 1 : 0);
+    kinds.push_back(kindOf(property));
+    cities.push_back(property.getCitySymbol());
+    rooms.push_back(roomsOf(property));
+}
+
+void PropertyColumns::erase(size_t row)
+{
+    auto offset = static_cast<std::ptrdiff_t>(row);
+    prices.erase(prices.begin() + offset);
+    areas.erase(areas.begin() + offset);
+    available.erase(available.begin() + offset);
+    kinds.erase(kinds.begin() + offset);
+    cities.erase(cities.begin() + offset);
+    rooms.erase(rooms.begin() + offset);
+}
+
+SelectionBitmap PropertyColumns::evaluate(const PropertyFilter &filter) const
+{
+    return evaluate(filter, FilterKernels::active());
+}
+
+SelectionBitmap PropertyColumns::evaluate(const PropertyFilter &filter, const FilterKernels &kernels) const
+{
+    size_t count = size();
+    SelectionBitmap selection(count);
+    uint64_t *bits = selection.data();
+
+    if (filter.minPrice || filter.maxPrice)
+    {
+        int64_t low = filter.minPrice ? filter.minPrice->getKopecks() : std::numeric_limits<int64_t>::min();
+        int64_t high = filter.maxPrice ? filter.maxPrice->getKopecks() : std::numeric_limits<int64_t>::max();
+        kernels.int64Range(prices.data(), count, low, high, bits);
+    }
+    if (filter.minArea || filter.maxArea)
+    {
+        double low = filter.minArea.value_or(std::numeric_limits<double>::lowest());
+        double high = filter.maxArea.value_or(std::numeric_limits<double>::max());
+        kernels.doubleRange(areas.data(), count, low, high, bits);
+    }
+    if (filter.available)
+    {
+        kernels.byteEqual(available.data(), count, *filter.available ? 1 : 0, bits);
+    }
+    if (filter.kind)
+    {
+        kernels.byteEqual(reinterpret_cast<const uint8_t *>(kinds.data()), count, static_cast<uint8_t>(*filter.kind),
+                          bits);
+    }
+    if (filter.city)
+    {
+        kernels.symbolEqual(cities.data(), count, *filter.city, bits);
+    }
+    if (filter.minRooms)
+    {
+        kernels.int32AtLeast(rooms.data(), count, *filter.minRooms, bits);
+    }
+    return selection;
+}
+
+bool PropertyColumns::matches(size_t row, const PropertyFilter &filter) const
+{
+    return (!filter.minPrice || prices[row] >= filter.minPrice->getKopecks()) &&
+           (!filter.maxPrice || prices[row] <= filter.maxPrice->getKopecks()) &&
+           (!filter.minArea || areas[row] >= *filter.minArea) && (!filter.maxArea || areas[row] <= *filter.maxArea) &&
+           (!filter.available || (available[row] != 0) == *filter.available) &&
+           (!filter.kind || kinds[row] == *filter.kind) && (!filter.city || cities[row] == *filter.city) &&
+           (!filter.minRooms || rooms[row] >= *filter.minRooms);
+}
+
+std::vector<uint32_t> PropertyColumns::select(const PropertyFilter &filter) const
+{
+    SelectionBitmap selection = evaluate(filter);
+    std::vector<uint32_t> rows;
+    rows.reserve(selection.count());
+    selection.forEach([&rows](size_t row) { rows.push_back(static_cast<uint32_t>(row)); });
+    return rows;
+}
+
+PropertyAggregate PropertyColumns::aggregate(const PropertyFilter &filter) const
+{
+    SelectionBitmap selection = evaluate(filter);
+
+    PropertyAggregate result;
+    int64_t total = 0;
+    int64_t low = std::numeric_limits<int64_t>::max();
+    int64_t high = std::numeric_limits<int64_t>::min();
+    double totalArea = 0.0;
+    selection.forEach(
+        [&](size_t row)
+        {
+            int64_t price = prices[row];
+            total += price;
+            totalArea += areas[row];
+            low = std::min(low, price);
+            high = std::max(high, price);
+            ++result.count;
+        });
+
+    result.totalPrice = Money::fromKopecks(total);
+    result.totalArea = totalArea;
+    if (result.count > 0)
+    {
+        result.minPrice = Money::fromKopecks(low);
+        result.maxPrice = Money::fromKopecks(high);
+    }
+    return result;
+}
+
+size_t PropertyColumns::getMemoryBytes() const
+{
+    return Memory::vectorHeapBytes(prices) + Memory::vectorHeapBytes(areas) + Memory::vectorHeapBytes(available) +
+           Memory::vectorHeapBytes(kinds) + Memory::vectorHeapBytes(cities) + Memory::vectorHeapBytes(rooms);
+}
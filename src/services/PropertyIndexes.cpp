@@ -0,0 +1,102 @@
+#include "../../include/services/PropertyIndexes.h"
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+template <typename Key> std::shared_ptr<const RowList> buildOrder(std::span<const Key> keys)
+{
+    auto order = std::make_shared<RowList>(keys.size());
+    std::iota(order->begin(), order->end(), 0U);
+    std::ranges::stable_sort(*order, [keys](uint32_t left, uint32_t right) { return keys[left] < keys[right]; });
+    return order;
+}
+} 
+
+void PropertyIndexes::invalidate()
+{
+    std::scoped_lock lock(mutex);
+    priceOrder.reset();
+    areaOrder.reset();
+    cityPostings.reset();
+    idRows.reset();
+}
+
+std::shared_ptr<const RowList> PropertyIndexes::getPriceOrder(const PropertyColumns &columns) const
+{
+    std::scoped_lock lock(mutex);
+    if (!priceOrder)
+    {
+        priceOrder = buildOrder(columns.getPrices());
+    }
+    return priceOrder;
+}
+
+std::shared_ptr<const RowList> PropertyIndexes::getAreaOrder(const PropertyColumns &columns) const
+{
+    std::scoped_lock lock(mutex);
+    if (!areaOrder)
+    {
+        areaOrder = buildOrder(columns.getAreas());
+    }
+    return areaOrder;
+}
+
+std::shared_ptr<const SymbolPostings> PropertyIndexes::getCityPostings(const PropertyColumns &columns) const
+{
+    std::scoped_lock lock(mutex);
+    if (!cityPostings)
+    {
+        auto postings = std::make_shared<SymbolPostings>();
+        auto cities = columns.getCities();
+        for (size_t row = 0; row < cities.size(); ++row)
+        {
+            (*postings)[cities[row]].push_back(static_cast<uint32_t>(row));
+        }
+        cityPostings = std::move(postings);
+    }
+    return cityPostings;
+}
+
+std::shared_ptr<const IdRows> PropertyIndexes::getIdRows(const std::vector<ArenaPtr<Property>> &properties) const
+{
+    std::scoped_lock lock(mutex);
+    if (!idRows)
+    {
+        auto rows = std::make_shared<IdRows>();
+        rows->reserve(properties.size());
+        for (size_t row = 0; row < properties.size(); ++row)
+        {
+            rows->try_emplace(properties[row]->getId(), static_cast<uint32_t>(row));
+        }
+        idRows = std::move(rows);
+    }
+    return idRows;
+}
+
+size_t PropertyIndexes::getMemoryBytes() const
+{
+    std::scoped_lock lock(mutex);
+    size_t bytes = 0;
+    if (priceOrder)
+    {
+        bytes += Memory::vectorHeapBytes(*priceOrder);
+    }
+    if (areaOrder)
+    {
+        bytes += Memory::vectorHeapBytes(*areaOrder);
+    }
+    if (cityPostings)
+    {
+        bytes += cityPostings->bucket_count() * sizeof(void *);
+        for (const auto &[city, rows] : *cityPostings)
+        {
+            bytes += Memory::HASH_NODE_OVERHEAD + sizeof(city) + sizeof(rows) + Memory::vectorHeapBytes(rows);
+        }
+    }
+    if (idRows)
+    {
+        bytes += Memory::stringMapHeapBytes(*idRows);
+    }
+    return bytes;
+}
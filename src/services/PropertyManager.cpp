@@ -1,15 +1,29 @@
 #include "../../include/services/PropertyManager.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/core/Utils.h"
 #include "../../include/entities/Apartment.h"
 #include "../../include/entities/CommercialProperty.h"
 #include "../../include/entities/House.h"
 #include <algorithm>
 #include <cctype>
+#include <ctime>
 #include <ranges>
+#include <stdexcept>
 
 PropertyManager::PropertyManager() = default;
 
-void PropertyManager::addProperty(std::unique_ptr<Property> property)
+EntityArena &PropertyManager::getArena()
+{
+    if (!arena)
+    {
+        arena = std::make_shared<EntityArena>();
+    }
+    return *arena;
+}
+
+void PropertyManager::addProperty(PropertyPtr property)
 {
     if (!property)
     {
@@ -19,14 +33,25 @@ void PropertyManager::addProperty(std::unique_ptr<Property> property)
     {
         throw PropertyManagerException("Property with ID " + property->getId() + " already exists");
     }
+    columns.append(*property);
+    indexes.invalidate();
+    {
+        std::scoped_lock lock(liveStatsMutex);
+        liveStatsByCity.add(property->getCitySymbol(), property->getPrice());
+    }
+    priceHistory.record(property->getId(), std::time(nullptr), property->getPrice());
     properties.push_back(std::move(property));
+    if (changeCallback)
+    {
+        changeCallback(*properties.back());
+    }
 }
 
 void PropertyManager::addApartment(const ApartmentParams &params)
 {
     try
     {
-        auto apartment = std::make_unique<Apartment>(params);
+        auto apartment = getArena().makeUnique<Apartment>(params);
         addProperty(std::move(apartment));
     }
     catch (const std::exception &e)
@@ -39,7 +64,7 @@ void PropertyManager::addHouse(const HouseParams &params)
 {
     try
     {
-        auto houseObj = std::make_unique<House>(params);
+        auto houseObj = getArena().makeUnique<House>(params);
         addProperty(std::move(houseObj));
     }
     catch (const std::exception &e)
@@ -52,7 +77,7 @@ void PropertyManager::addCommercialProperty(const CommercialPropertyParams &para
 {
     try
     {
-        auto commercial = std::make_unique<CommercialProperty>(params);
+        auto commercial = getArena().makeUnique<CommercialProperty>(params);
         addProperty(std::move(commercial));
     }
     catch (const std::exception &e)
@@ -63,11 +88,16 @@ void PropertyManager::addCommercialProperty(const CommercialPropertyParams &para
 
 bool PropertyManager::removeProperty(const std::string &id)
 {
-    if (auto removed = std::ranges::remove_if(properties, [&id](const std::unique_ptr<Property> &prop)
-                                              { return prop->getId() == id; });
-        removed.begin() != properties.end())
+    if (auto it = std::ranges::find_if(properties, [&id](const PropertyPtr &prop) { return prop->getId() == id; });
+        it != properties.end())
     {
-        properties.erase(removed.begin(), properties.end());
+        columns.erase(static_cast<size_t>(it - properties.begin()));
+        indexes.invalidate();
+        {
+            std::scoped_lock lock(liveStatsMutex);
+            liveStatsByCity.remove((*it)->getCitySymbol(), (*it)->getPrice());
+        }
+        properties.erase(it);
         return true;
     }
     return false;
@@ -75,93 +105,275 @@ bool PropertyManager::removeProperty(const std::string &id)
 
 Property *PropertyManager::findProperty(const std::string &id) const
 {
+    static Counter &hits = MetricsRegistry::instance().counter("property.lookup.hits");
+    static Counter &misses = MetricsRegistry::instance().counter("property.lookup.misses");
     if (auto it = std::ranges::find_if(properties,
-                                       [&id](const std::unique_ptr<Property> &prop) { return prop->getId() == id; });
+                                       [&id](const PropertyPtr &prop) { return prop->getId() == id; });
         it != properties.end())
     {
+        hits.increment();
         return it->get();
     }
+    misses.increment();
     return nullptr;
 }
 
-std::vector<Property *> PropertyManager::getAllProperties() const
+void PropertyManager::setAvailable(const Property *property, bool available)
 {
-    std::vector<Property *> result;
-    result.reserve(properties.size());
-    for (const auto &prop : properties)
+    if (auto it = std::ranges::find_if(properties,
+                                       [property](const PropertyPtr &prop) { return prop.get() == property; });
+        it != properties.end())
     {
-        result.push_back(prop.get());
+        (*it)->setAvailable(available);
+        columns.setAvailable(static_cast<size_t>(it - properties.begin()), available);
     }
-    return result;
 }
 
-std::vector<Property *> PropertyManager::getAvailableProperties() const
+void PropertyManager::setPrice(const Property *property, Money price)
 {
-    std::vector<Property *> result;
-    for (const auto &prop : properties)
+    auto it = std::ranges::find_if(properties, [property](const PropertyPtr &prop) { return prop.get() == property; });
+    if (it == properties.end() || (*it)->getPrice() == price)
     {
-        if (prop->getIsAvailable())
-        {
-            result.push_back(prop.get());
-        }
+        return;
+    }
+    Money previous = (*it)->getPrice();
+    try
+    {
+        (*it)->setPrice(price);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        throw PropertyManagerException(e.what());
+    }
+    columns.setPrice(static_cast<size_t>(it - properties.begin()), price);
+    indexes.invalidate();
+    {
+        std::scoped_lock lock(liveStatsMutex);
+        liveStatsByCity.remove((*it)->getCitySymbol(), previous);
+        liveStatsByCity.add((*it)->getCitySymbol(), price);
+    }
+    if (!priceHistory.contains((*it)->getId()))
+    {
+        priceHistory.record((*it)->getId(), PriceHistory::UNKNOWN_TIME, previous);
+    }
+    priceHistory.record((*it)->getId(), std::time(nullptr), price);
+    if (changeCallback)
+    {
+        changeCallback(**it);
     }
-    return result;
 }
 
-std::vector<Property *> PropertyManager::searchByPriceRange(double minPrice, double maxPrice) const
+std::vector<Property *> PropertyManager::collectRows(const std::vector<uint32_t> &rows) const
 {
     std::vector<Property *> result;
-    for (const auto &prop : properties)
+    result.reserve(rows.size());
+    for (uint32_t row : rows)
     {
-        double price = prop->getPrice();
-        if (price >= minPrice && price <= maxPrice)
-        {
-            result.push_back(prop.get());
-        }
+        result.push_back(properties[row].get());
     }
     return result;
 }
 
+std::vector<Property *> PropertyManager::getAvailableProperties() const
+{
+    PropertyFilter filter;
+    filter.available = true;
+    return search(filter);
+}
+
+std::vector<Property *> PropertyManager::searchByPriceRange(Money minPrice, Money maxPrice) const
+{
+    TRACE_SCOPE("PropertyManager::searchByPriceRange");
+    METRIC_TIME_SCOPE("property.search_by_price.duration_ns");
+    PropertyFilter filter;
+    filter.minPrice = minPrice;
+    filter.maxPrice = maxPrice;
+    return search(filter);
+}
+
 std::vector<Property *> PropertyManager::searchByAddress(const std::string &city, const std::string &street,
                                                          const std::string &house) const
 {
-    std::vector<Property *> result;
+    TRACE_SCOPE("PropertyManager::searchByAddress");
+    METRIC_TIME_SCOPE("property.search_by_address.duration_ns");
+    if (city.empty() && street.empty() && house.empty())
+    {
+        return {};
+    }
 
-    std::string lowerCity = city;
-    std::string lowerStreet = street;
     std::string lowerHouse = house;
-    std::ranges::transform(lowerCity, lowerCity.begin(), [](unsigned char c) { return std::tolower(c); });
-    std::ranges::transform(lowerStreet, lowerStreet.begin(), [](unsigned char c) { return std::tolower(c); });
     std::ranges::transform(lowerHouse, lowerHouse.begin(), [](unsigned char c) { return std::tolower(c); });
 
-    for (const auto &prop : properties)
+    return ThreadPool::instance().collect<Property *>(
+        properties.size(),
+        [this, &city, &street, &lowerHouse](size_t begin, size_t end, std::vector<Property *> &result)
+        {
+            SymbolMatcher cityMatcher(city);
+            SymbolMatcher streetMatcher(street);
+            for (size_t i = begin; i < end; ++i)
+            {
+                const Property &prop = *properties[i];
+                if (cityMatcher.isActive() && !cityMatcher.matches(prop.getCitySymbol()))
+                {
+                    continue;
+                }
+                if (streetMatcher.isActive() && !streetMatcher.matches(prop.getStreetSymbol()))
+                {
+                    continue;
+                }
+                if (!lowerHouse.empty())
+                {
+                    std::string propHouse = prop.getHouse();
+                    std::ranges::transform(propHouse, propHouse.begin(),
+                                           [](unsigned char c) { return std::tolower(c); });
+                    if (!Utils::stringContains(propHouse, lowerHouse))
+                    {
+                        continue;
+                    }
+                }
+                result.push_back(properties[i].get());
+            }
+        });
+}
+
+std::vector<Property *> PropertyManager::searchByCity(std::string_view city) const
+{
+    TRACE_SCOPE("PropertyManager::searchByCity");
+    METRIC_TIME_SCOPE("property.search_by_city.duration_ns");
+    auto symbol = StringPool::instance().find(city);
+    if (!symbol)
+    {
+        return {};
+    }
+    PropertyFilter filter;
+    filter.city = *symbol;
+    return search(filter);
+}
+
+std::unordered_map<Symbol, size_t> PropertyManager::countByCity() const
+{
+    std::unordered_map<Symbol, size_t> counts;
+    for (Symbol city : columns.getCities())
     {
-        std::string propCity = prop->getCity();
-        std::string propStreet = prop->getStreet();
-        std::string propHouse = prop->getHouse();
+        ++counts[city];
+    }
+    return counts;
+}
 
-        std::ranges::transform(propCity, propCity.begin(), [](unsigned char c) { return std::tolower(c); });
-        std::ranges::transform(propStreet, propStreet.begin(), [](unsigned char c) { return std::tolower(c); });
-        std::ranges::transform(propHouse, propHouse.begin(), [](unsigned char c) { return std::tolower(c); });
+std::vector<Property *> PropertyManager::search(const PropertyFilter &filter) const
+{
+    return collectRows(columns.select(filter));
+}
 
-        bool matches = true;
-        if (!lowerCity.empty() && !Utils::stringContains(propCity, lowerCity))
-        {
-            matches = false;
-        }
-        if (!lowerStreet.empty() && !Utils::stringContains(propStreet, lowerStreet))
-        {
-            matches = false;
-        }
-        if (!lowerHouse.empty() && !Utils::stringContains(propHouse, lowerHouse))
-        {
-            matches = false;
-        }
+PropertyAggregate PropertyManager::aggregate(const PropertyFilter &filter) const
+{
+    METRIC_TIME_SCOPE("property.aggregate.duration_ns");
+    return columns.aggregate(filter);
+}
 
-        if (matches && (!lowerCity.empty() || !lowerStreet.empty() || !lowerHouse.empty()))
+GroupedAggregate<Symbol> PropertyManager::groupPricesByCity(const PropertyFilter &filter) const
+{
+    SelectionBitmap selection = columns.evaluate(filter);
+    auto cities = columns.getCities();
+    auto prices = columns.getPrices();
+    return groupRows<Symbol>(
+        columns.size(),
+        [&selection, cities](size_t row) { return selection.test(row) ? std::optional(cities[row]) : std::nullopt; },
+        [prices](AggregateStats &stats, size_t row) { stats.add(Money::fromKopecks(prices[row])); });
+}
+
+GroupedAggregate<std::string> PropertyManager::aggregateByCity(const PropertyFilter &filter) const
+{
+    TRACE_SCOPE("PropertyManager::aggregateByCity");
+    METRIC_TIME_SCOPE("property.aggregate_by_city.duration_ns");
+    return rekeyGroups(groupPricesByCity(filter),
+                       [](Symbol city) { return std::string(StringPool::instance().resolve(city)); });
+}
+
+GroupedAggregate<PropertyKind> PropertyManager::aggregateByKind(const PropertyFilter &filter) const
+{
+    TRACE_SCOPE("PropertyManager::aggregateByKind");
+    METRIC_TIME_SCOPE("property.aggregate_by_kind.duration_ns");
+    SelectionBitmap selection = columns.evaluate(filter);
+    auto kinds = columns.getKinds();
+    auto prices = columns.getPrices();
+    return groupRows<PropertyKind>(
+        columns.size(),
+        [&selection, kinds](size_t row) { return selection.test(row) ? std::optional(kinds[row]) : std::nullopt; },
+        [prices](AggregateStats &stats, size_t row) { stats.add(Money::fromKopecks(prices[row])); });
+}
+
+GroupedAggregate<std::string> PropertyManager::getLiveStatsByCity() const
+{
+    static Counter &rebuilds = MetricsRegistry::instance().counter("property.live_stats.rebuilds");
+    std::scoped_lock lock(liveStatsMutex);
+    if (!liveStatsByCity.isBuilt())
+    {
+        rebuilds.increment();
+        liveStatsByCity.reset(groupPricesByCity({}));
+    }
+    const auto &groups = liveStatsByCity.get(
+        [this](Symbol city)
         {
-            result.push_back(prop.get());
-        }
+            rebuilds.increment();
+            PropertyFilter filter;
+            filter.city = city;
+            return groupPricesByCity(filter)[city];
+        });
+
+    GroupedAggregate<std::string> result;
+    for (const auto &[city, stats] : groups)
+    {
+        result.emplace(StringPool::instance().resolve(city), stats);
     }
     return result;
 }
+
+PropertyQueryResult PropertyManager::query(const PropertyQuery &query) const
+{
+    return PropertyQueryPlanner::plan(query, properties, columns, indexes);
+}
+
+std::vector<Property *> PropertyManager::topK(const PropertyFilter &filter, size_t k, PropertyField field,
+                                              bool descending) const
+{
+    TRACE_SCOPE("PropertyManager::topK");
+    METRIC_TIME_SCOPE("property.top_k.duration_ns");
+    return query(PropertyQuery::fromFilter(filter).orderBy(field, descending).limit(k)).toVector();
+}
+
+MemoryUsage PropertyManager::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objectCount = properties.size();
+    usage.indexBytes = Memory::vectorHeapBytes(properties) + columns.getMemoryBytes() + indexes.getMemoryBytes() +
+                       priceHistory.getMemoryBytes();
+    {
+        std::scoped_lock lock(liveStatsMutex);
+        usage.indexBytes += liveStatsByCity.getMemoryBytes();
+    }
+    usage.arenaBytes = arena ? arena->getReservedBytes() : 0;
+    for (const auto &prop : properties)
+    {
+        usage.objectBytes += prop->getObjectSize();
+        usage.stringBytes += prop->getStringBytes();
+    }
+    return usage;
+}
+
+void PropertyManager::setProperties(std::vector<PropertyPtr> &&props, std::shared_ptr<EntityArena> newArena)
+{
+    properties = std::move(props);
+    arena = std::move(newArena);
+    columns.clear();
+    indexes.invalidate();
+    {
+        std::scoped_lock lock(liveStatsMutex);
+        liveStatsByCity.invalidate();
+    }
+    columns.reserve(properties.size());
+    for (const auto &prop : properties)
+    {
+        columns.append(*prop);
+    }
+}
@@ -0,0 +1,873 @@
+#include "../../include/services/PropertyQuery.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/TopK.h"
+#include "../../include/core/Tracing.h"
+#include "../../include/entities/Apartment.h"
+#include "../../include/entities/CommercialProperty.h"
+#include "../../include/entities/House.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <compare>
+#include <format>
+#include <limits>
+#include <ranges>
+
+namespace
+{
+constexpr double INDEX_ROW_COST = 8.0;
+constexpr double SCAN_ROW_COST = 1.0;
+
+constexpr size_t MONEY_VALUE = 1;
+constexpr size_t NUMBER_VALUE = 2;
+constexpr size_t BOOL_VALUE = 3;
+constexpr size_t TEXT_VALUE = 4;
+constexpr size_t KIND_VALUE = 5;
+
+struct FieldInfo
+{
+    PropertyField field;
+    std::string_view name;
+    size_t valueIndex;
+};
+
+constexpr std::array FIELDS{
+    FieldInfo{PropertyField::Id, "id", TEXT_VALUE},
+    FieldInfo{PropertyField::City, "city", TEXT_VALUE},
+    FieldInfo{PropertyField::Street, "street", TEXT_VALUE},
+    FieldInfo{PropertyField::House, "house", TEXT_VALUE},
+    FieldInfo{PropertyField::Price, "price", MONEY_VALUE},
+    FieldInfo{PropertyField::Area, "area", NUMBER_VALUE},
+    FieldInfo{PropertyField::Available, "available", BOOL_VALUE},
+    FieldInfo{PropertyField::Kind, "kind", KIND_VALUE},
+    FieldInfo{PropertyField::Rooms, "rooms", NUMBER_VALUE},
+    FieldInfo{PropertyField::Floor, "floor", NUMBER_VALUE},
+    FieldInfo{PropertyField::HasBalcony, "has_balcony", BOOL_VALUE},
+    FieldInfo{PropertyField::HasElevator, "has_elevator", BOOL_VALUE},
+    FieldInfo{PropertyField::Floors, "floors", NUMBER_VALUE},
+    FieldInfo{PropertyField::LandArea, "land_area", NUMBER_VALUE},
+    FieldInfo{PropertyField::HasGarage, "has_garage", BOOL_VALUE},
+    FieldInfo{PropertyField::HasGarden, "has_garden", BOOL_VALUE},
+    FieldInfo{PropertyField::BusinessType, "business_type", TEXT_VALUE},
+    FieldInfo{PropertyField::HasParking, "has_parking", BOOL_VALUE},
+    FieldInfo{PropertyField::ParkingSpaces, "parking_spaces", NUMBER_VALUE},
+    FieldInfo{PropertyField::IsVisibleFromStreet, "visible_from_street", BOOL_VALUE},
+};
+
+const FieldInfo &getFieldInfo(PropertyField field) { return FIELDS[static_cast<size_t>(field)]; }
+
+std::string_view getOpName(QueryOp op)
+{
+    switch (op)
+    {
+    case QueryOp::Equal:
+        return "=";
+    case QueryOp::NotEqual:
+        return "!=";
+    case QueryOp::Less:
+        return "<";
+    case QueryOp::LessEqual:
+        return "<=";
+    case QueryOp::Greater:
+        return ">";
+    case QueryOp::GreaterEqual:
+        return ">=";
+    case QueryOp::Between:
+        return "between";
+    default:
+        return "contains";
+    }
+}
+
+std::string_view getKindName(PropertyKind kind)
+{
+    switch (kind)
+    {
+    case PropertyKind::Apartment:
+        return "apartment";
+    case PropertyKind::House:
+        return "house";
+    default:
+        return "commercial";
+    }
+}
+
+std::string formatValue(const QueryValue &value)
+{
+    return std::visit(
+        [](const auto &item) -> std::string
+        {
+            using T = std::decay_t<decltype(item)>;
+            if constexpr (std::is_same_v<T, std::monostate>)
+                return "null";
+            else if constexpr (std::is_same_v<T, Money>)
+                return item.toString();
+            else if constexpr (std::is_same_v<T, double>)
+                return std::format("{}", item);
+            else if constexpr (std::is_same_v<T, bool>)
+                return item ? "true" : "false";
+            else if constexpr (std::is_same_v<T, std::string>)
+                return std::format("\"{}\"", item);
+            else
+                return std::string(getKindName(item));
+        },
+        value);
+}
+
+std::string describe(const QueryPredicate &predicate)
+{
+    std::string text = std::format("{} {} {}", getFieldInfo(predicate.field).name, getOpName(predicate.op),
+                                   formatValue(predicate.value));
+    if (predicate.op == QueryOp::Between)
+    {
+        text += " and " + formatValue(predicate.upper);
+    }
+    return text;
+}
+
+std::string toLower(std::string_view text)
+{
+    std::string lowered(text);
+    std::ranges::transform(lowered, lowered.begin(), [](unsigned char c) { return std::tolower(c); });
+    return lowered;
+}
+
+std::partial_ordering compareValues(const QueryValue &left, const QueryValue &right)
+{
+    if (left.index() != right.index())
+    {
+        return std::partial_ordering::unordered;
+    }
+    return std::visit([&right](const auto &value) -> std::partial_ordering
+                      { return value <=> std::get<std::decay_t<decltype(value)>>(right); },
+                      left);
+}
+
+bool matchesValue(const std::optional<QueryValue> &actual, const QueryPredicate &predicate)
+{
+    if (!actual)
+    {
+        return false;
+    }
+    if (predicate.op == QueryOp::Contains)
+    {
+        return toLower(std::get<std::string>(*actual)).contains(std::get<std::string>(predicate.value));
+    }
+
+    std::partial_ordering order = compareValues(*actual, predicate.value);
+    switch (predicate.op)
+    {
+    case QueryOp::Equal:
+        return order == 0;
+    case QueryOp::NotEqual:
+        return order != 0;
+    case QueryOp::Less:
+        return order < 0;
+    case QueryOp::LessEqual:
+        return order <= 0;
+    case QueryOp::Greater:
+        return order > 0;
+    case QueryOp::GreaterEqual:
+        return order >= 0;
+    default:
+        return order >= 0 && compareValues(*actual, predicate.upper) <= 0;
+    }
+}
+
+std::optional<QueryValue> readRowField(const std::vector<ArenaPtr<Property>> &properties,
+                                       const PropertyColumns &columns, uint32_t row, PropertyField field)
+{
+    switch (field)
+    {
+    case PropertyField::Price:
+        return Money::fromKopecks(columns.getPrices()[row]);
+    case PropertyField::Area:
+        return columns.getAreas()[row];
+    case PropertyField::Available:
+        return columns.getAvailability()[row] != 0;
+    case PropertyField::Kind:
+        return columns.getKinds()[row];
+    default:
+        return PropertyQuery::readField(*properties[row], field);
+    }
+}
+
+void validate(const QueryPredicate &predicate)
+{
+    const FieldInfo &info = getFieldInfo(predicate.field);
+    if (predicate.value.index() != info.valueIndex ||
+        (predicate.op == QueryOp::Between && predicate.upper.index() != info.valueIndex))
+    {
+        throw PropertyQueryException(std::format("Invalid value type for field '{}'", info.name));
+    }
+
+    bool ordered = info.valueIndex == MONEY_VALUE || info.valueIndex == NUMBER_VALUE || info.valueIndex == TEXT_VALUE;
+    bool supported = predicate.op == QueryOp::Equal || predicate.op == QueryOp::NotEqual ||
+                     (predicate.op == QueryOp::Contains && info.valueIndex == TEXT_VALUE) ||
+                     (predicate.op != QueryOp::Contains && ordered);
+    if (!supported)
+    {
+        throw PropertyQueryException(
+            std::format("Operator '{}' is not supported for field '{}'", getOpName(predicate.op), info.name));
+    }
+}
+
+template <typename T> struct Range
+{
+    T low = std::numeric_limits<T>::lowest();
+    T high = std::numeric_limits<T>::max();
+};
+
+template <typename T> bool narrowRange(Range<T> &range, const QueryPredicate &predicate, T value, T upper)
+{
+    constexpr T lowest = std::numeric_limits<T>::lowest();
+    constexpr T highest = std::numeric_limits<T>::max();
+    T below = value;
+    T above = value;
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        below = std::nextafter(value, lowest);
+        above = std::nextafter(value, highest);
+    }
+    else
+    {
+        below = value > lowest ? value - 1 : lowest;
+        above = value < highest ? value + 1 : highest;
+    }
+
+    switch (predicate.op)
+    {
+    case QueryOp::Equal:
+        range.low = std::max(range.low, value);
+        range.high = std::min(range.high, value);
+        return true;
+    case QueryOp::Less:
+        if (below == value)
+        {
+            range = {highest, lowest};
+            return true;
+        }
+        range.high = std::min(range.high, below);
+        return true;
+    case QueryOp::LessEqual:
+        range.high = std::min(range.high, value);
+        return true;
+    case QueryOp::Greater:
+        if (above == value)
+        {
+            range = {highest, lowest};
+            return true;
+        }
+        range.low = std::max(range.low, above);
+        return true;
+    case QueryOp::GreaterEqual:
+        range.low = std::max(range.low, value);
+        return true;
+    case QueryOp::Between:
+        range.low = std::max(range.low, value);
+        range.high = std::min(range.high, upper);
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct PushDown
+{
+    PropertyFilter filter;
+    std::optional<Range<int64_t>> price;
+    std::optional<Range<double>> area;
+    std::vector<std::string> pushed;
+    bool empty = false;
+};
+
+bool pushDown(const QueryPredicate &predicate, PushDown &state)
+{
+    switch (predicate.field)
+    {
+    case PropertyField::Price:
+    {
+        auto upper = predicate.op == QueryOp::Between ? std::get<Money>(predicate.upper).getKopecks() : 0;
+        Range<int64_t> &range = state.price ? *state.price : state.price.emplace();
+        return narrowRange(range, predicate, std::get<Money>(predicate.value).getKopecks(), upper);
+    }
+    case PropertyField::Area:
+    {
+        auto upper = predicate.op == QueryOp::Between ? std::get<double>(predicate.upper) : 0.0;
+        Range<double> &range = state.area ? *state.area : state.area.emplace();
+        return narrowRange(range, predicate, std::get<double>(predicate.value), upper);
+    }
+    case PropertyField::Available:
+    {
+        if (predicate.op != QueryOp::Equal && predicate.op != QueryOp::NotEqual)
+        {
+            return false;
+        }
+        bool wanted = std::get<bool>(predicate.value) == (predicate.op == QueryOp::Equal);
+        state.empty |= state.filter.available && *state.filter.available != wanted;
+        state.filter.available = wanted;
+        return true;
+    }
+    case PropertyField::Kind:
+    {
+        if (predicate.op != QueryOp::Equal)
+        {
+            return false;
+        }
+        auto wanted = std::get<PropertyKind>(predicate.value);
+        state.empty |= state.filter.kind && *state.filter.kind != wanted;
+        state.filter.kind = wanted;
+        return true;
+    }
+    case PropertyField::City:
+    {
+        if (predicate.op != QueryOp::Equal)
+        {
+            return false;
+        }
+        auto symbol = StringPool::instance().find(std::get<std::string>(predicate.value));
+        state.empty |= !symbol || (state.filter.city && *state.filter.city != *symbol);
+        if (symbol)
+        {
+            state.filter.city = *symbol;
+        }
+        return true;
+    }
+    case PropertyField::Rooms:
+    {
+        if (predicate.op != QueryOp::GreaterEqual && predicate.op != QueryOp::Greater)
+        {
+            return false;
+        }
+        double value = std::get<double>(predicate.value);
+        double low = predicate.op == QueryOp::GreaterEqual ? std::ceil(value) : std::floor(value) + 1.0;
+        if (low < 1.0 || low > std::numeric_limits<int>::max())
+        {
+            return false;
+        }
+        state.filter.minRooms = std::max(state.filter.minRooms.value_or(0), static_cast<int>(low));
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+struct AccessPath
+{
+    std::string description;
+    std::shared_ptr<const RowList> rows;
+    size_t begin = 0;
+    size_t end = 0;
+    std::optional<PropertyField> orderedBy;
+
+    size_t size() const { return end - begin; }
+};
+
+template <typename Key>
+AccessPath rangePath(std::shared_ptr<const RowList> order, std::span<const Key> keys, Key low, Key high,
+                     PropertyField field, std::string description)
+{
+    auto lower = std::ranges::partition_point(*order, [&](uint32_t row) { return keys[row] < low; });
+    auto upper = std::ranges::partition_point(*order, [&](uint32_t row) { return keys[row] <= high; });
+    AccessPath path{std::move(description), order, static_cast<size_t>(lower - order->begin()), 0, field};
+    path.end = std::max(path.begin, static_cast<size_t>(upper - order->begin()));
+    return path;
+}
+
+std::vector<AccessPath> collectPaths(const std::vector<QueryPredicate> &predicates, const PushDown &state,
+                                     const std::vector<ArenaPtr<Property>> &properties,
+                                     const PropertyColumns &columns, const PropertyIndexes &indexes)
+{
+    std::vector<AccessPath> paths;
+    for (const auto &predicate : predicates)
+    {
+        if (predicate.field == PropertyField::Id && predicate.op == QueryOp::Equal)
+        {
+            auto ids = indexes.getIdRows(properties);
+            auto it = ids->find(std::get<std::string>(predicate.value));
+            auto rows = std::make_shared<RowList>();
+            if (it != ids->end())
+            {
+                rows->push_back(it->second);
+            }
+            paths.push_back({"id index", rows, 0, rows->size(), std::nullopt});
+        }
+    }
+    if (state.filter.city)
+    {
+        auto postings = indexes.getCityPostings(columns);
+        if (auto it = postings->find(*state.filter.city); it != postings->end())
+        {
+            std::shared_ptr<const RowList> rows(postings, &it->second);
+            paths.push_back({"city index", rows, 0, rows->size(), std::nullopt});
+        }
+    }
+    if (state.price)
+    {
+        paths.push_back(rangePath(indexes.getPriceOrder(columns), columns.getPrices(), state.price->low,
+                                  state.price->high, PropertyField::Price, "price index"));
+    }
+    if (state.area)
+    {
+        paths.push_back(rangePath(indexes.getAreaOrder(columns), columns.getAreas(), state.area->low, state.area->high,
+                                  PropertyField::Area, "area index"));
+    }
+    return paths;
+}
+
+void applyRanges(PushDown &state)
+{
+    if (state.price)
+    {
+        state.empty |= state.price->low > state.price->high;
+        state.filter.minPrice = Money::fromKopecks(state.price->low);
+        state.filter.maxPrice = Money::fromKopecks(state.price->high);
+    }
+    if (state.area)
+    {
+        state.empty |= state.area->low > state.area->high;
+        state.filter.minArea = state.area->low;
+        state.filter.maxArea = state.area->high;
+    }
+}
+
+std::string joinDescriptions(const std::vector<std::string> &descriptions)
+{
+    std::string joined;
+    for (const auto &text : descriptions)
+    {
+        joined += (joined.empty() ? "" : ", ") + text;
+    }
+    return joined;
+}
+
+bool prefersOrderedWalk(const PropertyQuery &query, size_t matches, size_t rowCount)
+{
+    if (!query.getLimit())
+    {
+        return true;
+    }
+    size_t wanted = query.getOffset() + std::min(*query.getLimit(), rowCount);
+    double walkedRows = static_cast<double>(wanted) * static_cast<double>(rowCount) / std::max<double>(1.0, matches);
+    return walkedRows < static_cast<double>(matches);
+}
+} 
+
+PropertyQuery &PropertyQuery::where(PropertyField field, QueryOp op, QueryValue value)
+{
+    predicates.push_back({field, op, std::move(value), std::monostate{}});
+    return *this;
+}
+
+PropertyQuery &PropertyQuery::between(PropertyField field, QueryValue low, QueryValue high)
+{
+    predicates.push_back({field, QueryOp::Between, std::move(low), std::move(high)});
+    return *this;
+}
+
+PropertyQuery &PropertyQuery::orderBy(PropertyField field, bool descending)
+{
+    sort = QuerySort{field, descending};
+    return *this;
+}
+
+PropertyQuery &PropertyQuery::offset(size_t rows)
+{
+    offsetRows = rows;
+    return *this;
+}
+
+PropertyQuery &PropertyQuery::limit(size_t rows)
+{
+    limitRows = rows;
+    return *this;
+}
+
+PropertyQuery PropertyQuery::fromFilter(const PropertyFilter &filter)
+{
+    PropertyQuery query;
+    if (filter.minPrice)
+    {
+        query.where(PropertyField::Price, QueryOp::GreaterEqual, *filter.minPrice);
+    }
+    if (filter.maxPrice)
+    {
+        query.where(PropertyField::Price, QueryOp::LessEqual, *filter.maxPrice);
+    }
+    if (filter.minArea)
+    {
+        query.where(PropertyField::Area, QueryOp::GreaterEqual, *filter.minArea);
+    }
+    if (filter.maxArea)
+    {
+        query.where(PropertyField::Area, QueryOp::LessEqual, *filter.maxArea);
+    }
+    if (filter.available)
+    {
+        query.where(PropertyField::Available, QueryOp::Equal, *filter.available);
+    }
+    if (filter.kind)
+    {
+        query.where(PropertyField::Kind, QueryOp::Equal, *filter.kind);
+    }
+    if (filter.city)
+    {
+        query.where(PropertyField::City, QueryOp::Equal, std::string(StringPool::instance().resolve(*filter.city)));
+    }
+    if (filter.minRooms)
+    {
+        query.where(PropertyField::Rooms, QueryOp::GreaterEqual, static_cast<double>(*filter.minRooms));
+    }
+    return query;
+}
+
+std::string_view PropertyQuery::getFieldName(PropertyField field) { return getFieldInfo(field).name; }
+
+std::optional<QueryValue> PropertyQuery::readField(const Property &property, PropertyField field)
+{
+    const auto *apartment = dynamic_cast<const Apartment *>(&property);
+    const auto *house = dynamic_cast<const House *>(&property);
+    const auto *commercial = dynamic_cast<const CommercialProperty *>(&property);
+
+    switch (field)
+    {
+    case PropertyField::Id:
+        return property.getId();
+    case PropertyField::City:
+        return property.getCity();
+    case PropertyField::Street:
+        return property.getStreet();
+    case PropertyField::House:
+        return property.getHouse();
+    case PropertyField::Price:
+        return property.getPrice();
+    case PropertyField::Area:
+        return property.getArea();
+    case PropertyField::Available:
+        return property.getIsAvailable();
+    case PropertyField::Kind:
+        return PropertyColumns::kindOf(property);
+    case PropertyField::Rooms:
+        if (apartment)
+            return static_cast<double>(apartment->getRooms());
+        if (house)
+            return static_cast<double>(house->getRooms());
+        return std::nullopt;
+    case PropertyField::Floor:
+        return apartment ? std::optional<QueryValue>(static_cast<double>(apartment->getFloor())) : std::nullopt;
+    case PropertyField::HasBalcony:
+        return apartment ? std::optional<QueryValue>(apartment->getHasBalcony()) : std::nullopt;
+    case PropertyField::HasElevator:
+        return apartment ? std::optional<QueryValue>(apartment->getHasElevator()) : std::nullopt;
+    case PropertyField::Floors:
+        return house ? std::optional<QueryValue>(static_cast<double>(house->getFloors())) : std::nullopt;
+    case PropertyField::LandArea:
+        return house ? std::optional<QueryValue>(house->getLandArea()) : std::nullopt;
+    case PropertyField::HasGarage:
+        return house ? std::optional<QueryValue>(house->getHasGarage()) : std::nullopt;
+    case PropertyField::HasGarden:
+        return house ? std::optional<QueryValue>(house->getHasGarden()) : std::nullopt;
+    case PropertyField::BusinessType:
+        return commercial ? std::optional<QueryValue>(commercial->getBusinessType()) : std::nullopt;
+    case PropertyField::HasParking:
+        return commercial ? std::optional<QueryValue>(commercial->getHasParking()) : std::nullopt;
+    case PropertyField::ParkingSpaces:
+        return commercial ? std::optional<QueryValue>(static_cast<double>(commercial->getParkingSpaces()))
+                          : std::nullopt;
+    default:
+        return commercial ? std::optional<QueryValue>(commercial->getIsVisibleFromStreet()) : std::nullopt;
+    }
+}
+
+size_t PropertyQueryResult::findCandidate(size_t cursor) const
+{
+    if (rows)
+    {
+        return cursor < rowsEnd - rowsBegin ? cursor : END;
+    }
+    if (selection)
+    {
+        size_t row = selection->findNext(cursor);
+        return row < selection->size() ? row : END;
+    }
+    return END;
+}
+
+uint32_t PropertyQueryResult::rowAt(size_t cursor) const
+{
+    if (!rows)
+    {
+        return static_cast<uint32_t>(cursor);
+    }
+    return reversed ? (*rows)[rowsEnd - 1 - cursor] : (*rows)[rowsBegin + cursor];
+}
+
+bool PropertyQueryResult::accepts(uint32_t row) const
+{
+    if (rows && selection && !selection->test(row))
+    {
+        return false;
+    }
+    if (rowFilter && !columns->matches(row, *rowFilter))
+    {
+        return false;
+    }
+    return std::ranges::all_of(residual, [this, row](const QueryPredicate &predicate)
+                               { return matchesValue(readRowField(*properties, *columns, row, predicate.field),
+                                                     predicate); });
+}
+
+PropertyQueryResult::Iterator::Iterator(const PropertyQueryResult *result, size_t cursor) : result(result)
+{
+    seek(cursor);
+    for (size_t skipped = 0; skipped < result->offsetRows && this->cursor != END; ++skipped)
+    {
+        seek(this->cursor + 1);
+    }
+    if (result->limitRows && *result->limitRows == 0)
+    {
+        this->cursor = END;
+    }
+}
+
+void PropertyQueryResult::Iterator::seek(size_t from)
+{
+    cursor = result->findCandidate(from);
+    while (cursor != END && !result->accepts(result->rowAt(cursor)))
+    {
+        cursor = result->findCandidate(cursor + 1);
+    }
+}
+
+Property *PropertyQueryResult::Iterator::operator*() const
+{
+    return (*result->properties)[result->rowAt(cursor)].get();
+}
+
+PropertyQueryResult::Iterator &PropertyQueryResult::Iterator::operator++()
+{
+    ++produced;
+    if (result->limitRows && produced >= *result->limitRows)
+    {
+        cursor = END;
+        return *this;
+    }
+    seek(cursor + 1);
+    return *this;
+}
+
+PropertyQueryResult::Iterator PropertyQueryResult::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+PropertyQueryResult::Iterator PropertyQueryResult::begin() const { return {this, 0}; }
+
+std::vector<Property *> PropertyQueryResult::toVector() const
+{
+    std::vector<Property *> result;
+    for (Property *property : *this)
+    {
+        result.push_back(property);
+    }
+    return result;
+}
+
+size_t PropertyQueryResult::count() const
+{
+    size_t total = 0;
+    for (auto it = begin(); it != end(); ++it)
+    {
+        ++total;
+    }
+    return total;
+}
+
+PropertyQueryResult PropertyQueryPlanner::plan(const PropertyQuery &query,
+                                               const std::vector<ArenaPtr<Property>> &properties,
+                                               const PropertyColumns &columns, const PropertyIndexes &indexes)
+{
+    TRACE_SCOPE("PropertyQueryPlanner::plan");
+    METRIC_TIME_SCOPE("property.query.plan.duration_ns");
+
+    PropertyQueryResult result;
+    result.properties = &properties;
+    result.columns = &columns;
+    result.offsetRows = query.getOffset();
+    result.limitRows = query.getLimit();
+
+    std::vector<QueryPredicate> predicates = query.getPredicates();
+    PushDown state;
+    std::vector<QueryPredicate> residual;
+    for (auto &predicate : predicates)
+    {
+        validate(predicate);
+        if (predicate.op == QueryOp::Contains)
+        {
+            predicate.value = toLower(std::get<std::string>(predicate.value));
+        }
+        if (pushDown(predicate, state))
+        {
+            state.pushed.push_back(describe(predicate));
+        }
+        else
+        {
+            residual.push_back(predicate);
+        }
+    }
+    applyRanges(state);
+
+    std::vector<std::string> steps;
+    const auto &sort = query.getSort();
+    size_t rowCount = properties.size();
+
+    if (state.empty)
+    {
+        result.rows = std::make_shared<RowList>();
+        result.plan = "Empty (contradictory or unknown values)";
+        return result;
+    }
+
+    std::vector<AccessPath> paths = collectPaths(predicates, state, properties, columns, indexes);
+    auto best = std::ranges::min_element(paths, {}, &AccessPath::size);
+    bool useIndex = best != paths.end() &&
+                    static_cast<double>(best->size()) * INDEX_ROW_COST < static_cast<double>(rowCount) * SCAN_ROW_COST;
+
+    if (useIndex)
+    {
+        result.rows = best->rows;
+        result.rowsBegin = best->begin;
+        result.rowsEnd = best->end;
+        result.estimatedRows = best->size();
+        result.rowFilter = state.filter;
+        result.residual = residual;
+        steps.push_back(std::format("IndexScan({}, {} rows)", best->description, best->size()));
+        if (!state.pushed.empty())
+        {
+            steps.push_back(std::format("ColumnFilter({})", joinDescriptions(state.pushed)));
+        }
+        for (const auto &predicate : residual)
+        {
+            steps.push_back("Filter(" + describe(predicate) + ")");
+        }
+    }
+    else
+    {
+        const FilterKernels &kernels = FilterKernels::active();
+        result.selection = columns.evaluate(state.filter, kernels);
+        result.residual = residual;
+        result.estimatedRows = result.selection->count();
+        std::string pushed = joinDescriptions(state.pushed);
+        steps.push_back(std::format("ColumnScan({}, {} of {} rows{}{})", FilterKernels::getLevelName(kernels.level),
+                                    result.estimatedRows, rowCount, pushed.empty() ? "" : ": ", pushed));
+        for (const auto &predicate : residual)
+        {
+            steps.push_back("Filter(" + describe(predicate) + ")");
+        }
+    }
+
+    if (sort)
+    {
+        std::string_view sortName = PropertyQuery::getFieldName(sort->field);
+        const char *direction = sort->descending ? "desc" : "asc";
+        bool sortedIndexField = sort->field == PropertyField::Price || sort->field == PropertyField::Area;
+
+        if (useIndex && best->orderedBy == sort->field)
+        {
+            result.reversed = sort->descending;
+            steps.push_back(std::format("Ordered by index ({} {})", sortName, direction));
+        }
+        else if (!useIndex && sortedIndexField && prefersOrderedWalk(query, result.estimatedRows, rowCount))
+        {
+            result.rows = sort->field == PropertyField::Price ? indexes.getPriceOrder(columns)
+                                                               : indexes.getAreaOrder(columns);
+            result.rowsBegin = 0;
+            result.rowsEnd = result.rows->size();
+            result.reversed = sort->descending;
+            steps.push_back(std::format("OrderedIndexWalk({} {})", sortName, direction));
+        }
+        else
+        {
+            using KeyedRow = std::pair<std::optional<QueryValue>, uint32_t>;
+            auto less = [descending = sort->descending](const KeyedRow &left, const KeyedRow &right)
+            {
+                if (left.first.has_value() != right.first.has_value())
+                {
+                    return left.first.has_value();
+                }
+                if (left.first)
+                {
+                    std::partial_ordering order = compareValues(*left.first, *right.first);
+                    if (order != 0)
+                    {
+                        return descending ? order > 0 : order < 0;
+                    }
+                }
+                return left.second < right.second;
+            };
+
+            size_t matchedRows = 0;
+            auto forEachMatch = [&result, &matchedRows](auto &&visit)
+            {
+                for (size_t cursor = result.findCandidate(0); cursor != PropertyQueryResult::END;
+                     cursor = result.findCandidate(cursor + 1))
+                {
+                    if (uint32_t row = result.rowAt(cursor); result.accepts(row))
+                    {
+                        ++matchedRows;
+                        visit(row);
+                    }
+                }
+            };
+
+            std::vector<KeyedRow> keyed;
+            if (query.getLimit())
+            {
+                size_t needed = std::min(rowCount, query.getOffset() + std::min(*query.getLimit(), rowCount));
+                BoundedHeap<KeyedRow, decltype(less)> heap(needed, less);
+                forEachMatch([&](uint32_t row)
+                             { heap.push({readRowField(properties, columns, row, sort->field), row}); });
+                keyed = heap.takeSorted();
+            }
+            else
+            {
+                forEachMatch([&](uint32_t row)
+                             { keyed.emplace_back(readRowField(properties, columns, row, sort->field), row); });
+                std::ranges::sort(keyed, less);
+            }
+
+            auto sorted = std::make_shared<RowList>();
+            sorted->reserve(keyed.size());
+            for (const auto &[key, row] : keyed)
+            {
+                sorted->push_back(row);
+            }
+            result.rows = sorted;
+            result.rowsBegin = 0;
+            result.rowsEnd = sorted->size();
+            result.reversed = false;
+            result.selection.reset();
+            result.rowFilter.reset();
+            result.residual.clear();
+            result.estimatedRows = matchedRows;
+            steps.push_back(std::format("{}({} {}, {} rows)", query.getLimit() ? "TopK" : "Sort", sortName, direction,
+                                        matchedRows));
+        }
+    }
+
+    if (query.getOffset() > 0 || query.getLimit())
+    {
+        steps.push_back(query.getLimit() ? std::format("Offset {} Limit {}", query.getOffset(), *query.getLimit())
+                                         : std::format("Offset {}", query.getOffset()));
+    }
+
+    for (const auto &step : steps)
+    {
+        result.plan += (result.plan.empty() ? "" : " -> ") + step;
+    }
+    return result;
+}
@@ -0,0 +1,171 @@
+#include "../../include/services/ProxyBidding.h"
+#include "../../include/entities/Bid.h"
+#include <algorithm>
+#include <memory>
+
+bool ProxyBidding::isLive(const Book &book, const ProxyBid &proxy)
+{
+    auto it = book.live.find(proxy.clientId);
+    return it != book.live.end() && it->second.sequence == proxy.sequence;
+}
+
+void ProxyBidding::prune(Book &book)
+{
+    while (!book.heap.empty() && !isLive(book, book.heap.top()))
+    {
+        book.heap.pop();
+    }
+}
+
+void ProxyBidding::dropExhausted(Book &book, const Auction &auction)
+{
+    Money minimumNextBid = auction.getMinimumNextBid();
+    prune(book);
+    while (!book.heap.empty() && std::min(book.heap.top().maxAmount, auction.getBuyoutPrice()) < minimumNextBid)
+    {
+        book.live.erase(book.heap.top().clientId);
+        book.heap.pop();
+        prune(book);
+    }
+}
+
+bool ProxyBidding::placeBid(Auction &auction, const ProxyBid &proxy, Money amount)
+{
+    return auction.addBid(std::make_shared<Bid>(proxy.clientId, proxy.clientName, amount));
+}
+
+size_t ProxyBidding::registerProxy(const std::string &auctionId, const std::string &clientId,
+                                   const std::string &clientName, Money maxAmount)
+{
+    Auction *auction = auctionManager.findAuction(auctionId);
+    if (!auction)
+    {
+        throw ProxyBiddingException("Auction with ID " + auctionId + " not found");
+    }
+    if (!auction->isActive())
+    {
+        throw ProxyBiddingException("Auction " + auctionId + " is not active");
+    }
+    if (!maxAmount.isPositive())
+    {
+        throw ProxyBiddingException("Proxy maximum must be positive");
+    }
+
+    const Bid *current = auction->getHighestBid();
+    bool holdsLead = current && current->getClientId() == clientId;
+    if (!holdsLead && maxAmount < auction->getMinimumNextBid())
+    {
+        throw ProxyBiddingException("Proxy maximum is below the minimum next bid " +
+                                    auction->getMinimumNextBid().toString());
+    }
+
+    Book &book = books[auctionId];
+    ProxyBid proxy{clientId, clientName, maxAmount, nextSequence++};
+    book.live[clientId] = proxy;
+    book.heap.push(proxy);
+
+    return resolve(*auction);
+}
+
+bool ProxyBidding::withdrawProxy(const std::string &auctionId, const std::string &clientId)
+{
+    auto it = books.find(auctionId);
+    if (it == books.end())
+    {
+        return false;
+    }
+    return it->second.live.erase(clientId) > 0;
+}
+
+size_t ProxyBidding::resolve(Auction &auction)
+{
+    auto it = books.find(auction.getId());
+    if (it == books.end())
+    {
+        return 0;
+    }
+    if (!auction.isActive())
+    {
+        books.erase(it);
+        return 0;
+    }
+
+    Book &book = it->second;
+    Money buyoutPrice = auction.getBuyoutPrice();
+
+    prune(book);
+    if (book.heap.empty())
+    {
+        return 0;
+    }
+
+    ProxyBid leader = book.heap.top();
+    Money leaderCap = std::min(leader.maxAmount, buyoutPrice);
+    const Bid *current = auction.getHighestBid();
+    bool leaderHolds = current && current->getClientId() == leader.clientId;
+
+    if (!leaderHolds && leaderCap < auction.getMinimumNextBid())
+    {
+        books.erase(it);
+        return 0;
+    }
+
+    book.heap.pop();
+    prune(book);
+
+    size_t placed = 0;
+    Money rival = current && !leaderHolds ? current->getAmount() : Money();
+
+    if (!book.heap.empty())
+    {
+        const ProxyBid &second = book.heap.top();
+        Money secondCap = std::min(second.maxAmount, buyoutPrice);
+        if (secondCap < leaderCap && secondCap >= auction.getMinimumNextBid() && placeBid(auction, second, secondCap))
+        {
+            ++placed;
+        }
+        rival = std::max(rival, secondCap);
+    }
+
+    current = auction.getHighestBid();
+    leaderHolds = current && current->getClientId() == leader.clientId;
+    if (!leaderHolds || rival > current->getAmount())
+    {
+        Money target = std::min(leaderCap, std::max(auction.getMinimumNextBid(), rival + Auction::MIN_BID_INCREMENT));
+        if (placeBid(auction, leader, target))
+        {
+            ++placed;
+        }
+    }
+
+    if (!auction.isActive())
+    {
+        books.erase(it);
+        return placed;
+    }
+
+    dropExhausted(book, auction);
+    book.heap.push(leader);
+    return placed;
+}
+
+std::optional<Money> ProxyBidding::getProxyMaximum(const std::string &auctionId, const std::string &clientId) const
+{
+    auto bookIt = books.find(auctionId);
+    if (bookIt == books.end())
+    {
+        return std::nullopt;
+    }
+    auto it = bookIt->second.live.find(clientId);
+    if (it == bookIt->second.live.end())
+    {
+        return std::nullopt;
+    }
+    return it->second.maxAmount;
+}
+
+size_t ProxyBidding::getProxyCount(const std::string &auctionId) const
+{
+    auto it = books.find(auctionId);
+    return it == books.end() ? 0 : it->second.live.size();
+}
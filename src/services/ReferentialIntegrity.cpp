@@ -0,0 +1,100 @@
+#include "../../include/services/ReferentialIntegrity.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
+#include <format>
+
+ReferentialIntegrity::ReferentialIntegrity(PropertyManager &propertyManager, ClientManager &clientManager,
+                                           TransactionManager &transactionManager, AuctionManager &auctionManager,
+                                           ClientMatcher &clientMatcher, AuctionScheduler &auctionScheduler,
+                                           ProxyBidding &proxyBidding)
+    : propertyManager(propertyManager), clientManager(clientManager), transactionManager(transactionManager),
+      auctionManager(auctionManager), clientMatcher(clientMatcher), auctionScheduler(auctionScheduler),
+      proxyBidding(proxyBidding)
+{
+}
+
+Dependents ReferentialIntegrity::getPropertyDependents(const std::string &propertyId) const
+{
+    return {transactionManager.getTransactionsByProperty(propertyId), auctionManager.getAuctionsByProperty(propertyId)};
+}
+
+Dependents ReferentialIntegrity::getClientDependents(const std::string &clientId) const
+{
+    return {transactionManager.getTransactionsByClient(clientId), {}};
+}
+
+void ReferentialIntegrity::releaseAuctions(const std::vector<Auction *> &auctions, bool cancel)
+{
+    for (Auction *auction : auctions)
+    {
+        auctionScheduler.unscheduleAuction(auction->getId());
+        proxyBidding.forgetAuction(auction->getId());
+        if (cancel)
+        {
+            auction->cancel();
+        }
+    }
+}
+
+DeleteResult ReferentialIntegrity::removeProperty(const std::string &propertyId, DeletePolicy policy)
+{
+    TRACE_SCOPE("ReferentialIntegrity::removeProperty");
+    METRIC_TIME_SCOPE("integrity.remove_property.duration_ns");
+    DeleteResult result;
+    if (propertyManager.findProperty(propertyId) == nullptr)
+    {
+        return result;
+    }
+
+    Dependents dependents = getPropertyDependents(propertyId);
+    if (policy == DeletePolicy::Restrict && !dependents.empty())
+    {
+        throw ReferentialIntegrityException(
+            std::format("Property {} is referenced by {} transaction(s) and {} auction(s)", propertyId,
+                        dependents.transactions.size(), dependents.auctions.size()));
+    }
+    if (policy == DeletePolicy::Nullify && !dependents.transactions.empty())
+    {
+        throw ReferentialIntegrityException(std::format(
+            "Property {} is referenced by {} transaction(s); transaction references cannot be cleared", propertyId,
+            dependents.transactions.size()));
+    }
+
+    if (policy == DeletePolicy::Cascade)
+    {
+        releaseAuctions(dependents.auctions, false);
+        result.transactionsRemoved = transactionManager.removeTransactionsByProperty(propertyId);
+        result.auctionsRemoved = auctionManager.removeAuctionsByProperty(propertyId);
+    }
+    else
+    {
+        releaseAuctions(dependents.auctions, true);
+        result.auctionsDetached = auctionManager.detachAuctionsFromProperty(propertyId);
+    }
+    result.pricePointsRemoved = propertyManager.erasePriceHistory(propertyId);
+    result.removed = propertyManager.removeProperty(propertyId);
+    return result;
+}
+
+DeleteResult ReferentialIntegrity::removeClient(const std::string &clientId, DeletePolicy policy)
+{
+    TRACE_SCOPE("ReferentialIntegrity::removeClient");
+    METRIC_TIME_SCOPE("integrity.remove_client.duration_ns");
+    DeleteResult result;
+    if (clientManager.findClient(clientId) == nullptr)
+    {
+        return result;
+    }
+
+    Dependents dependents = getClientDependents(clientId);
+    if (policy != DeletePolicy::Cascade && !dependents.empty())
+    {
+        throw ReferentialIntegrityException(
+            std::format("Client {} is referenced by {} transaction(s)", clientId, dependents.transactions.size()));
+    }
+
+    result.transactionsRemoved = transactionManager.removeTransactionsByClient(clientId);
+    result.profilesRemoved = clientMatcher.removeProfilesByClient(clientId);
+    result.removed = clientManager.removeClient(clientId);
+    return result;
+}
@@ -0,0 +1,395 @@
+#include "../../include/services/ReportGenerator.h"
+#include "../../include/core/Constants.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Tracing.h"
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+
+namespace
+{
+constexpr size_t DAY_KEY_LENGTH = 10;
+constexpr size_t MONTH_KEY_LENGTH = 7;
+constexpr size_t YEAR_KEY_LENGTH = 4;
+constexpr double P90 = 0.9;
+constexpr size_t ESTIMATED_ROW_BYTES = 128;
+
+constexpr const char *MISSING_PROPERTY = "Не указана";
+constexpr const char *MISSING_CLIENT = "Не указан";
+constexpr const char *OUTCOME_BUYOUT = "Выкуп";
+constexpr const char *OUTCOME_SOLD = "Продан на торгах";
+constexpr const char *OUTCOME_NO_BIDS = "Без ставок";
+
+size_t periodKeyLength(ReportPeriod period)
+{
+    switch (period)
+    {
+    case ReportPeriod::Day:
+        return DAY_KEY_LENGTH;
+    case ReportPeriod::Year:
+        return YEAR_KEY_LENGTH;
+    case ReportPeriod::Month:
+        break;
+    }
+    return MONTH_KEY_LENGTH;
+}
+
+std::string_view transactionStatusLabel(std::string_view status)
+{
+    if (status == Constants::TransactionStatus::PENDING)
+    {
+        return Constants::DisplayStatus::PENDING;
+    }
+    if (status == Constants::TransactionStatus::COMPLETED)
+    {
+        return Constants::DisplayStatus::COMPLETED;
+    }
+    if (status == Constants::TransactionStatus::CANCELLED)
+    {
+        return Constants::DisplayStatus::CANCELLED;
+    }
+    return status;
+}
+
+std::string auctionOutcomeLabel(const Auction &auction)
+{
+    if (auction.isActive())
+    {
+        return Constants::DisplayStatus::ACTIVE;
+    }
+    if (!auction.isCompleted())
+    {
+        return Constants::DisplayStatus::AUCTION_CANCELLED;
+    }
+    if (auction.wasBuyout())
+    {
+        return OUTCOME_BUYOUT;
+    }
+    return auction.getHighestBid() != nullptr ? OUTCOME_SOLD : OUTCOME_NO_BIDS;
+}
+
+class RowWriter
+{
+  private:
+    ReportFormat format;
+    std::string text;
+    size_t rows = 0;
+    bool rowOpen = false;
+
+    void appendEscaped(std::string_view value)
+    {
+        if (format == ReportFormat::Html)
+        {
+            for (char c : value)
+            {
+                switch (c)
+                {
+                case '&':
+                    text += "&amp;";
+                    break;
+                case '<':
+                    text += "&lt;";
+                    break;
+                case '>':
+                    text += "&gt;";
+                    break;
+                case '"':
+                    text += "&quot;";
+                    break;
+                default:
+                    text += c;
+                }
+            }
+            return;
+        }
+        if (value.find_first_of(",\"\r\n") == std::string_view::npos)
+        {
+            text += value;
+            return;
+        }
+        text += '"';
+        for (char c : value)
+        {
+            if (c == '"')
+            {
+                text += '"';
+            }
+            text += c;
+        }
+        text += '"';
+    }
+
+    void appendCell(std::string_view value, bool header)
+    {
+        if (format == ReportFormat::Html)
+        {
+            text += rowOpen ? "" : "<tr>";
+            text += header ? "<th>" : "<td>";
+            appendEscaped(value);
+            text += header ? "</th>" : "</td>";
+        }
+        else
+        {
+            if (rowOpen)
+            {
+                text += ',';
+            }
+            appendEscaped(value);
+        }
+        rowOpen = true;
+    }
+
+    void closeRow()
+    {
+        text += format == ReportFormat::Html ? "</tr>\n" : "\n";
+        rowOpen = false;
+    }
+
+  public:
+    explicit RowWriter(ReportFormat format) : format(format) {}
+
+    void reserve(size_t bytes) { text.reserve(bytes); }
+
+    void writeHeader(std::initializer_list<std::string_view> columns)
+    {
+        for (std::string_view column : columns)
+        {
+            appendCell(column, true);
+        }
+        closeRow();
+    }
+
+    RowWriter &cell(std::string_view value)
+    {
+        appendCell(value, false);
+        return *this;
+    }
+
+    RowWriter &cell(Money amount)
+    {
+        char buffer[Money::MAX_TEXT_LENGTH];
+        return cell(std::string_view(buffer, amount.formatTo(buffer)));
+    }
+
+    RowWriter &cell(size_t value)
+    {
+        char buffer[std::numeric_limits<size_t>::digits10 + 1];
+        auto [end, error] = std::to_chars(std::begin(buffer), std::end(buffer), value);
+        (void)error;
+        return cell(std::string_view(buffer, end));
+    }
+
+    RowWriter &cells(const AggregateStats &stats)
+    {
+        return cell(stats.count).cell(stats.total).cell(stats.getAverage()).cell(stats.getMedian());
+    }
+
+    void endRow()
+    {
+        closeRow();
+        ++rows;
+    }
+
+    const std::string &getText() const { return text; }
+    size_t getRowCount() const { return rows; }
+};
+
+class ReportFile
+{
+  private:
+    std::string filename;
+    std::ofstream file;
+    ReportFormat format;
+    ReportSummary summary;
+
+    void append(std::string_view text)
+    {
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!file)
+        {
+            throw ReportGeneratorException("Failed to write report: " + filename);
+        }
+        summary.bytes += text.size();
+    }
+
+  public:
+    ReportFile(const std::string &filename, ReportFormat format, std::string_view title)
+        : filename(filename), file(filename, std::ios::binary), format(format)
+    {
+        if (!file.is_open())
+        {
+            throw ReportGeneratorException("Cannot open file for writing: " + filename);
+        }
+        if (format == ReportFormat::Html)
+        {
+            append(std::format("<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>{0}</title></head>\n"
+                               "<body><h1>{0}</h1>\n<table border=\"1\">\n",
+                               title));
+        }
+    }
+
+    void write(const RowWriter &rows)
+    {
+        append(rows.getText());
+        summary.rows += rows.getRowCount();
+    }
+
+    ReportSummary finish()
+    {
+        if (format == ReportFormat::Html)
+        {
+            append("</table>\n</body></html>\n");
+        }
+        file.close();
+        return summary;
+    }
+};
+} 
+
+ReportGenerator::ReportGenerator(const PropertyManager &properties, const ClientManager &clients,
+                                 const TransactionManager &transactions, const AuctionManager &auctions)
+    : propertyManager(properties), clientManager(clients), transactionManager(transactions), auctionManager(auctions)
+{
+}
+
+ReportFormat ReportGenerator::formatFromFilename(std::string_view filename)
+{
+    return filename.ends_with(".html") || filename.ends_with(".htm") ? ReportFormat::Html : ReportFormat::Csv;
+}
+
+ReportSummary ReportGenerator::writeSales(const std::string &filename, ReportFormat format,
+                                          std::string_view datePrefix) const
+{
+    TRACE_SCOPE("ReportGenerator::writeSales");
+    METRIC_TIME_SCOPE("report.sales.duration_ns");
+    auto propertyRows = propertyManager.getIdRows();
+    auto clientRows = clientManager.getIdRows();
+    const auto &properties = propertyManager.getProperties();
+    const auto &clients = clientManager.getClients();
+    const auto &transactions = transactionManager.getTransactions();
+
+    auto writeRow = [&](RowWriter &rows, const Transaction &trans)
+    {
+        std::string date = trans.getDate();
+        if (!date.starts_with(datePrefix))
+        {
+            return;
+        }
+        std::string propertyId = trans.getPropertyId();
+        std::string clientId = trans.getClientId();
+        rows.cell(trans.getId())
+            .cell(date)
+            .cell(transactionStatusLabel(trans.getStatus()))
+            .cell(trans.getFinalPrice())
+            .cell(propertyId);
+        if (auto property = propertyRows->find(propertyId); property != propertyRows->end())
+        {
+            rows.cell(properties[property->second]->getAddress());
+        }
+        else
+        {
+            rows.cell(MISSING_PROPERTY);
+        }
+        rows.cell(clientId);
+        if (auto client = clientRows->find(clientId); client != clientRows->end())
+        {
+            rows.cell(clients[client->second]->getName());
+        }
+        else
+        {
+            rows.cell(MISSING_CLIENT);
+        }
+        rows.endRow();
+    };
+
+    ReportFile file(filename, format, "Продажи");
+    RowWriter header(format);
+    header.writeHeader({"ID", "Дата", "Статус", "Цена", "ID объекта", "Адрес", "ID клиента", "Клиент"});
+    file.write(header);
+
+    ThreadPool &pool = ThreadPool::instance();
+    for (size_t blockBegin = 0; blockBegin < transactions.size(); blockBegin += ROWS_PER_BLOCK)
+    {
+        size_t blockRows = std::min(ROWS_PER_BLOCK, transactions.size() - blockBegin);
+        std::vector<RowWriter> parts(pool.getChunkCount(blockRows), RowWriter(format));
+        pool.parallelChunks(blockRows,
+                            [&](size_t chunk, size_t begin, size_t end)
+                            {
+                                parts[chunk].reserve((end - begin) * ESTIMATED_ROW_BYTES);
+                                for (size_t i = blockBegin + begin; i < blockBegin + end; ++i)
+                                {
+                                    if (transactions[i])
+                                    {
+                                        writeRow(parts[chunk], *transactions[i]);
+                                    }
+                                }
+                            });
+        for (const auto &part : parts)
+        {
+            file.write(part);
+        }
+    }
+    return file.finish();
+}
+
+ReportSummary ReportGenerator::writeSalesByPeriod(const std::string &filename, ReportFormat format,
+                                                  ReportPeriod period, std::string_view status) const
+{
+    TRACE_SCOPE("ReportGenerator::writeSalesByPeriod");
+    METRIC_TIME_SCOPE("report.sales_by_period.duration_ns");
+    auto groups = transactionManager.aggregateByDatePrefix(periodKeyLength(period), status);
+
+    RowWriter rows(format);
+    rows.writeHeader({"Период", "Сделок", "Сумма", "Средняя", "Медиана", "P90"});
+    for (const auto &[key, stats] : groups)
+    {
+        rows.cell(key).cells(stats).cell(stats.getPercentile(P90));
+        rows.endRow();
+    }
+    ReportFile file(filename, format, "Продажи по периодам");
+    file.write(rows);
+    return file.finish();
+}
+
+ReportSummary ReportGenerator::writeSalesByStatus(const std::string &filename, ReportFormat format) const
+{
+    TRACE_SCOPE("ReportGenerator::writeSalesByStatus");
+    METRIC_TIME_SCOPE("report.sales_by_status.duration_ns");
+    auto groups = transactionManager.aggregateByStatus();
+
+    RowWriter rows(format);
+    rows.writeHeader({"Статус", "Сделок", "Сумма", "Средняя", "Медиана"});
+    for (const auto &[status, stats] : groups)
+    {
+        rows.cell(transactionStatusLabel(status)).cells(stats);
+        rows.endRow();
+    }
+    ReportFile file(filename, format, "Продажи по статусам");
+    file.write(rows);
+    return file.finish();
+}
+
+ReportSummary ReportGenerator::writeAuctionOutcomes(const std::string &filename, ReportFormat format) const
+{
+    TRACE_SCOPE("ReportGenerator::writeAuctionOutcomes");
+    METRIC_TIME_SCOPE("report.auction_outcomes.duration_ns");
+    auto groups =
+        auctionManager.aggregate([](const Auction &auction) { return std::optional(auctionOutcomeLabel(auction)); });
+
+    RowWriter rows(format);
+    rows.writeHeader({"Исход", "Аукционов", "Сумма", "Средняя", "Медиана", "Со ставками"});
+    for (const auto &[outcome, stats] : groups)
+    {
+        rows.cell(outcome).cells(stats).cell(stats.valueCount);
+        rows.endRow();
+    }
+    ReportFile file(filename, format, "Итоги аукционов");
+    file.write(rows);
+    return file.finish();
+}
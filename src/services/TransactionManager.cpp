@@ -1,8 +1,17 @@
 #include "../../include/services/TransactionManager.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/core/Tracing.h"
 #include <algorithm>
+#include <numeric>
 #include <ranges>
 #include <string_view>
 
+namespace
+{
+constexpr size_t MONTH_KEY_LENGTH = 7;
+} 
+
 TransactionManager::TransactionManager() = default;
 
 void TransactionManager::addTransaction(std::shared_ptr<Transaction> transaction)
@@ -15,78 +24,222 @@ void TransactionManager::addTransaction(std::shared_ptr<Transaction> transaction
     {
         throw TransactionManagerException("Transaction with ID " + transaction->getId() + " already exists");
     }
+    rows.append(transaction->getId());
     transactions.push_back(transaction);
+    byProperty.add(transaction->getPropertyId(), transaction.get());
+    byClient.add(transaction->getClientId(), transaction.get());
+    invalidateDateOrder();
 }
 
 bool TransactionManager::removeTransaction(const std::string &id)
 {
-    if (auto removed = std::ranges::remove_if(transactions, [&id](const std::shared_ptr<Transaction> &trans)
-                                              { return trans->getId() == id; });
-        removed.begin() != transactions.end())
+    size_t row = rows.find(id);
+    if (row == RowDirectory::NO_ROW)
     {
-        transactions.erase(removed.begin(), transactions.end());
-        return true;
+        return false;
     }
-    return false;
+    Transaction *trans = transactions[row].get();
+    byProperty.remove(trans->getPropertyId(), trans);
+    byClient.remove(trans->getClientId(), trans);
+    rows.remove(transactions, row);
+    compactIfNeeded();
+    return true;
 }
 
-Transaction *TransactionManager::findTransaction(const std::string &id) const
+size_t TransactionManager::removeTransactionsByProperty(const std::string &propertyId)
 {
-    if (auto it = std::ranges::find_if(transactions, [&id](const std::shared_ptr<Transaction> &trans)
-                                       { return trans->getId() == id; });
-        it != transactions.end())
+    std::vector<Transaction *> removed = byProperty.extract(propertyId);
+    for (Transaction *trans : removed)
     {
-        return it->get();
+        byClient.remove(trans->getClientId(), trans);
     }
-    return nullptr;
+    return eraseTransactions(removed);
 }
 
-std::vector<Transaction *> TransactionManager::getAllTransactions() const
+size_t TransactionManager::removeTransactionsByClient(const std::string &clientId)
 {
-    std::vector<Transaction *> result;
-    result.reserve(transactions.size());
-    for (const auto &trans : transactions)
+    std::vector<Transaction *> removed = byClient.extract(clientId);
+    for (Transaction *trans : removed)
     {
-        result.push_back(trans.get());
+        byProperty.remove(trans->getPropertyId(), trans);
     }
-    return result;
+    return eraseTransactions(removed);
 }
 
-std::vector<Transaction *> TransactionManager::getTransactionsByClient(std::string_view clientId) const
+size_t TransactionManager::eraseTransactions(const std::vector<Transaction *> &removed)
 {
-    std::vector<Transaction *> result;
-    for (const auto &trans : transactions)
+    for (Transaction *trans : removed)
     {
-        if (trans->getClientId() == clientId)
-        {
-            result.push_back(trans.get());
-        }
+        rows.remove(transactions, rows.find(trans->getId()));
     }
-    return result;
+    compactIfNeeded();
+    return removed.size();
+}
+
+void TransactionManager::compactIfNeeded()
+{
+    if (rows.compactIfNeeded(transactions))
+    {
+        invalidateDateOrder();
+    }
+}
+
+Transaction *TransactionManager::findTransaction(const std::string &id) const
+{
+    static Counter &hits = MetricsRegistry::instance().counter("transaction.lookup.hits");
+    static Counter &misses = MetricsRegistry::instance().counter("transaction.lookup.misses");
+    if (size_t row = rows.find(id); row != RowDirectory::NO_ROW)
+    {
+        hits.increment();
+        return transactions[row].get();
+    }
+    misses.increment();
+    return nullptr;
+}
+
+std::vector<Transaction *> TransactionManager::getTransactionsByClient(std::string_view clientId) const
+{
+    TRACE_SCOPE("TransactionManager::getTransactionsByClient");
+    METRIC_TIME_SCOPE("transaction.by_client.duration_ns");
+    auto found = byClient.find(clientId);
+    return {found.begin(), found.end()};
 }
 
 std::vector<Transaction *> TransactionManager::getTransactionsByProperty(std::string_view propertyId) const
 {
+    TRACE_SCOPE("TransactionManager::getTransactionsByProperty");
+    METRIC_TIME_SCOPE("transaction.by_property.duration_ns");
+    auto found = byProperty.find(propertyId);
+    return {found.begin(), found.end()};
+}
+
+std::vector<Transaction *> TransactionManager::getTransactionsByStatus(std::string_view status) const
+{
+    TRACE_SCOPE("TransactionManager::getTransactionsByStatus");
+    METRIC_TIME_SCOPE("transaction.by_status.duration_ns");
+    return ThreadPool::instance().collect<Transaction *>(
+        transactions.size(),
+        [this, status](size_t begin, size_t end, std::vector<Transaction *> &result)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (transactions[i] && transactions[i]->getStatus() == status)
+                {
+                    result.push_back(transactions[i].get());
+                }
+            }
+        });
+}
+
+std::vector<Transaction *> TransactionManager::getMostRecent(size_t k, std::string_view status) const
+{
+    TRACE_SCOPE("TransactionManager::getMostRecent");
+    METRIC_TIME_SCOPE("transaction.most_recent.duration_ns");
     std::vector<Transaction *> result;
-    for (const auto &trans : transactions)
+    auto order = getDateOrder();
+    for (auto it = order->rbegin(); it != order->rend() && result.size() < k; ++it)
     {
-        if (trans->getPropertyId() == propertyId)
+        Transaction *trans = transactions[*it].get();
+        if (trans != nullptr && (status.empty() || trans->getStatus() == status))
         {
-            result.push_back(trans.get());
+            result.push_back(trans);
         }
     }
     return result;
 }
 
-std::vector<Transaction *> TransactionManager::getTransactionsByStatus(std::string_view status) const
+GroupedAggregate<std::string> TransactionManager::aggregateByDatePrefix(size_t length, std::string_view status) const
 {
-    std::vector<Transaction *> result;
-    for (const auto &trans : transactions)
+    TRACE_SCOPE("TransactionManager::aggregateByDatePrefix");
+    METRIC_TIME_SCOPE("transaction.aggregate_by_date.duration_ns");
+    return aggregate(
+        [length, status](const Transaction &trans) -> std::optional<std::string>
+        {
+            if (!status.empty() && trans.getStatus() != status)
+            {
+                return std::nullopt;
+            }
+            std::string key = trans.getDate();
+            key.resize(std::min(key.size(), length));
+            return key;
+        });
+}
+
+GroupedAggregate<std::string> TransactionManager::aggregateByMonth(std::string_view status) const
+{
+    return aggregateByDatePrefix(MONTH_KEY_LENGTH, status);
+}
+
+GroupedAggregate<std::string> TransactionManager::aggregateByStatus() const
+{
+    TRACE_SCOPE("TransactionManager::aggregateByStatus");
+    METRIC_TIME_SCOPE("transaction.aggregate_by_status.duration_ns");
+    return aggregate([](const Transaction &trans) { return std::optional(trans.getStatus()); });
+}
+
+std::shared_ptr<const std::vector<uint32_t>> TransactionManager::getDateOrder() const
+{
+    std::scoped_lock lock(dateOrderMutex);
+    if (!dateOrder)
+    {
+        auto order = std::make_shared<std::vector<uint32_t>>(transactions.size());
+        std::iota(order->begin(), order->end(), 0U);
+        std::erase_if(*order, [this](uint32_t row) { return !transactions[row]; });
+        std::ranges::stable_sort(*order, [this](uint32_t left, uint32_t right)
+                                 { return *transactions[left] < *transactions[right]; });
+        dateOrder = std::move(order);
+    }
+    return dateOrder;
+}
+
+void TransactionManager::invalidateDateOrder()
+{
+    std::scoped_lock lock(dateOrderMutex);
+    dateOrder.reset();
+}
+
+void TransactionManager::rebuildReferences()
+{
+    byProperty.clear();
+    byClient.clear();
+    for (const auto &transaction : transactions)
+    {
+        byProperty.add(transaction->getPropertyId(), transaction.get());
+        byClient.add(transaction->getClientId(), transaction.get());
+    }
+}
+
+MemoryUsage TransactionManager::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objectCount = getCount();
+    usage.objectBytes = getCount() * (sizeof(Transaction) + Memory::SHARED_CONTROL_BLOCK_BYTES);
+    usage.indexBytes = Memory::vectorHeapBytes(transactions) + rows.getMemoryBytes() +
+                       byProperty.getMemoryBytes() + byClient.getMemoryBytes();
     {
-        if (trans->getStatus() == status)
+        std::scoped_lock lock(dateOrderMutex);
+        if (dateOrder)
         {
-            result.push_back(trans.get());
+            usage.indexBytes += Memory::vectorHeapBytes(*dateOrder);
         }
     }
-    return result;
+    usage.arenaBytes = arena ? arena->getReservedBytes() : 0;
+    for (const auto &transaction : transactions)
+    {
+        if (transaction)
+        {
+            usage.stringBytes += transaction->getStringBytes();
+        }
+    }
+    return usage;
+}
+
+void TransactionManager::setTransactions(std::vector<std::shared_ptr<Transaction>> &&newTransactions,
+                                         std::shared_ptr<EntityArena> newArena)
+{
+    transactions = std::move(newTransactions);
+    arena = std::move(newArena);
+    rows.rebuild(transactions);
+    rebuildReferences();
+    invalidateDateOrder();
 }
@@ -1,22 +1,19 @@
 #include "../../include/ui/AuctionDialog.h"
 #include "../../include/core/EstateAgency.h"
-#include "../../include/core/Utils.h"
 #include "../../include/entities/Bid.h"
 #include "../../include/entities/Client.h"
 #include "../../include/entities/Property.h"
 #include "../../include/entities/Transaction.h"
+#include "../../include/services/AuctionSettlement.h"
+#include "../../include/services/ProxyBidding.h"
+#include "../../include/ui/UiUtils.h"
 #include <QFormLayout>
 #include <QGroupBox>
 #include <QHBoxLayout>
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QVBoxLayout>
-#include <cctype>
-#include <chrono>
 #include <ctime>
-#include <format>
-#include <iomanip>
-#include <sstream>
 
 AuctionDialog::AuctionDialog(QWidget *parent, Auction *editAuction, const QStringList &propertyIds)
     : QDialog(parent), isViewMode(editAuction != nullptr), currentAuction(editAuction), propertyIds(propertyIds)
@@ -185,6 +182,26 @@ void AuctionDialog::setupUI()
     formLayout->addRow("", buyoutPriceLabel);
     formLayout->addRow("", statusLabel);
 
+    if (isViewMode)
+    {
+        endTimeLabel = new QLabel("Окончание: без срока");
+        endTimeLabel->setStyleSheet("color: #8fa8b3; font-size: 9pt; padding-left: 5px;");
+        endTimeLabel->setToolTip("Ставка в последние минуты продлевает аукцион");
+        formLayout->addRow("", endTimeLabel);
+    }
+    else
+    {
+        durationSpin = new QSpinBox;
+        durationSpin->setMinimum(0);
+        durationSpin->setMaximum(720);
+        durationSpin->setValue(0);
+        durationSpin->setSuffix(" ч.");
+        durationSpin->setSpecialValueText("Без срока");
+        durationSpin->setToolTip("Длительность аукциона в часах\n"
+                                 "По истечении срока аукцион завершится автоматически");
+        formLayout->addRow("Длительность:", durationSpin);
+    }
+
     mainLayout->addWidget(auctionGroup);
 
     if (isViewMode)
@@ -220,6 +237,11 @@ void AuctionDialog::setupUI()
         bidFormLayout->addRow("Клиент:", clientCombo);
         bidFormLayout->addRow("Ставка:", bidAmountSpin);
 
+        proxyBidCheck = new QCheckBox("Автоставка до указанной суммы");
+        proxyBidCheck->setToolTip("Система будет автоматически перебивать ставки конкурентов\n"
+                                  "на минимальный шаг, не превышая указанный максимум");
+        bidFormLayout->addRow("", proxyBidCheck);
+
         auto *bidButtonsLayout = new QHBoxLayout;
         addBidBtn = new QPushButton("Сделать ставку");
         connect(addBidBtn, &QPushButton::clicked, this, &AuctionDialog::addBid);
@@ -245,6 +267,7 @@ void AuctionDialog::setupUI()
         bidsTable = nullptr;
         clientCombo = nullptr;
         bidAmountSpin = nullptr;
+        proxyBidCheck = nullptr;
         addBidBtn = nullptr;
         completeAuctionBtn = nullptr;
     }
@@ -286,7 +309,7 @@ void AuctionDialog::loadAuctionData(const Auction *auction)
         propertyCombo->setCurrentIndex(propIndex);
     }
 
-    priceSpin->setValue(auction->getStartingPrice());
+    priceSpin->setValue(auction->getStartingPrice().toDouble());
     updatePropertyInfo();
     refreshBids();
     refreshAuctionInfo();
@@ -312,7 +335,7 @@ void AuctionDialog::updatePropertyInfo()
     QString propId = propertyIds[propertyCombo->currentIndex()].split(" - ").first();
     if (const Property *prop = agency->getPropertyManager().findProperty(propId.toStdString()); prop)
     {
-        double propertyPrice = prop->getPrice();
+        double propertyPrice = prop->getPrice().toDouble();
         QString priceText = QString("Цена недвижимости: %1 руб.").arg(QString::number(propertyPrice, 'f', 2));
         propertyPriceLabel->setText(priceText);
 
@@ -321,19 +344,17 @@ void AuctionDialog::updatePropertyInfo()
             priceSpin->setValue(propertyPrice);
         }
 
-        double startingPrice = priceSpin->value();
-        double buyoutPrice = startingPrice * 1.7;
-        QString buyoutText =
-            QString("Цена автоматической покупки: %1 руб. (+70%%)").arg(QString::number(buyoutPrice, 'f', 2));
+        Money buyoutPrice = Auction::calculateBuyoutPrice(getStartingPrice());
+        QString buyoutText = QString("Цена автоматической покупки: %1 (+70%%)").arg(Utils::formatPrice(buyoutPrice));
         buyoutPriceLabel->setText(buyoutText);
     }
 
     connect(priceSpin, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this,
             [this](double value)
             {
-                double buyoutPrice = value * 1.7;
+                Money buyoutPrice = Auction::calculateBuyoutPrice(Money::fromDouble(value));
                 QString buyoutText =
-                    QString("Цена автоматической покупки: %1 руб. (+70%%)").arg(QString::number(buyoutPrice, 'f', 2));
+                    QString("Цена автоматической покупки: %1 (+70%%)").arg(Utils::formatPrice(buyoutPrice));
                 buyoutPriceLabel->setText(buyoutText);
             });
 }
@@ -351,7 +372,7 @@ void AuctionDialog::refreshBids()
         const auto &bid = bids[i];
         bidsTable->setItem(i, 0, new QTableWidgetItem(QString::fromStdString(bid->getClientName())));
         bidsTable->setItem(i, 1, new QTableWidgetItem(QString::fromStdString(bid->getClientId())));
-        bidsTable->setItem(i, 2, new QTableWidgetItem(QString::number(bid->getAmount(), 'f', 2) + " руб."));
+        bidsTable->setItem(i, 2, new QTableWidgetItem(Utils::formatPrice(bid->getAmount())));
         bidsTable->setItem(i, 3, new QTableWidgetItem(QString::fromStdString(bid->getTimestamp())));
     }
 
@@ -386,41 +407,64 @@ void AuctionDialog::addBid()
         return;
     }
 
-    double bidAmount = bidAmountSpin->value();
+    Money bidAmount = Money::fromDouble(bidAmountSpin->value());
+    size_t bidsBefore = currentAuction->getBidCount();
+    const Bid *leaderBefore = currentAuction->getHighestBid();
 
-    if (auto bid = std::make_shared<Bid>(clientId.toStdString(), client->getName(), bidAmount);
-        !currentAuction->addBid(bid))
+    if (proxyBidCheck->isChecked())
+    {
+        try
+        {
+            agency->getProxyBidding().registerProxy(currentAuction->getId(), clientId.toStdString(),
+                                                    client->getName(), bidAmount);
+        }
+        catch (const ProxyBiddingException &e)
+        {
+            QMessageBox::warning(this, "Ошибка", QString("Автоставка не принята: %1").arg(e.what()));
+            return;
+        }
+    }
+    else if (auto bid = std::make_shared<Bid>(clientId.toStdString(), client->getName(), bidAmount);
+             !currentAuction->addBid(bid))
     {
-        double currentHighest = currentAuction->getCurrentHighestBid();
-        double minBid = (currentHighest > 0) ? currentHighest + 0.01 : currentAuction->getStartingPrice();
+        Money minBid = currentAuction->getMinimumNextBid();
 
-        QString errorMsg = QString("Ставка слишком низкая!\n") +
-                           QString("Минимальная ставка: %1 руб.\n").arg(QString::number(minBid, 'f', 2));
+        QString errorMsg =
+            QString("Ставка слишком низкая!\n") + QString("Минимальная ставка: %1\n").arg(Utils::formatPrice(minBid));
 
         if (bidAmount >= currentAuction->getBuyoutPrice())
         {
-            errorMsg += QString("\n💡 При ставке %1 руб. недвижимость будет сразу выкуплена!")
-                            .arg(QString::number(currentAuction->getBuyoutPrice(), 'f', 2));
+            errorMsg += QString("\n💡 При ставке %1 недвижимость будет сразу выкуплена!")
+                            .arg(Utils::formatPrice(currentAuction->getBuyoutPrice()));
         }
 
         QMessageBox::warning(this, "Ошибка", errorMsg);
         return;
     }
+    else
+    {
+        agency->getProxyBidding().resolve(*currentAuction);
+    }
+
+    if (currentAuction->getBidCount() != bidsBefore || currentAuction->getHighestBid() != leaderBefore)
+    {
+        agency->getAuctionScheduler().onBidAccepted(*currentAuction, std::time(nullptr));
+    }
 
-    if (bidAmount >= currentAuction->getBuyoutPrice())
+    if (currentAuction->wasBuyout())
     {
         createTransactionFromAuction();
 
         QMessageBox::information(this, "Аукцион завершен",
                                  QString("Недвижимость автоматически выкуплена по "
-                                         "цене %1 руб.!\nСделка создана.")
-                                     .arg(QString::number(bidAmount, 'f', 2)));
+                                         "цене %1!\nСделка создана.")
+                                     .arg(Utils::formatPrice(currentAuction->getCurrentHighestBid())));
     }
 
     refreshBids();
     refreshAuctionInfo();
 
-    double newMinBid = currentAuction->getCurrentHighestBid() + 0.01;
+    double newMinBid = currentAuction->getMinimumNextBid().toDouble();
     bidAmountSpin->setMinimum(newMinBid);
     bidAmountSpin->setValue(newMinBid);
 
@@ -509,14 +553,21 @@ void AuctionDialog::refreshAuctionInfo()
     }
     statusLabel->setText("Статус: " + statusText);
 
+    if (endTimeLabel)
+    {
+        endTimeLabel->setText(currentAuction->hasDeadline()
+                                  ? "Окончание: " + QString::fromStdString(currentAuction->getEndTimeString())
+                                  : QString("Окончание: без срока"));
+    }
+
     if (currentHighestBidLabel)
     {
-        double highestBid = currentAuction->getCurrentHighestBid();
-        if (highestBid > 0)
+        Money highestBid = currentAuction->getCurrentHighestBid();
+        if (highestBid.isPositive())
         {
             const Bid *highest = currentAuction->getHighestBid();
-            QString bidText = QString("Текущая максимальная ставка: %1 руб. (клиент: %2)")
-                                  .arg(QString::number(highestBid, 'f', 2))
+            QString bidText = QString("Текущая максимальная ставка: %1 (клиент: %2)")
+                                  .arg(Utils::formatPrice(highestBid))
                                   .arg(QString::fromStdString(highest ? highest->getClientName() : "неизвестно"));
             currentHighestBidLabel->setText(bidText);
         }
@@ -525,7 +576,7 @@ void AuctionDialog::refreshAuctionInfo()
             currentHighestBidLabel->setText("Текущая максимальная ставка: нет ставок");
         }
 
-        double minBid = (highestBid > 0) ? highestBid + 0.01 : currentAuction->getStartingPrice();
+        double minBid = currentAuction->getMinimumNextBid().toDouble();
         bidAmountSpin->setMinimum(minBid);
         if (bidAmountSpin->value() < minBid)
         {
@@ -533,9 +584,8 @@ void AuctionDialog::refreshAuctionInfo()
         }
     }
 
-    double buyoutPrice = currentAuction->getBuyoutPrice();
     QString buyoutText =
-        QString("Цена автоматической покупки: %1 руб. (+70%%)").arg(QString::number(buyoutPrice, 'f', 2));
+        QString("Цена автоматической покупки: %1 (+70%%)").arg(Utils::formatPrice(currentAuction->getBuyoutPrice()));
     buyoutPriceLabel->setText(buyoutText);
 }
 
@@ -561,7 +611,7 @@ void AuctionDialog::validateAndAccept()
         return;
     }
 
-    if (double price = priceSpin->value(); price <= 0)
+    if (!getStartingPrice().isPositive())
     {
         QMessageBox::warning(this, "Ошибка", "Начальная цена должна быть положительной");
         return;
@@ -581,139 +631,18 @@ QString AuctionDialog::getPropertyId() const
     return "";
 }
 
-double AuctionDialog::getStartingPrice() const { return priceSpin->value(); }
-
-namespace
-{
-bool hasExistingTransaction(EstateAgency *agency, const std::string &propertyId, const std::string &clientId,
-                            double amount)
-{
-    auto existingTransactions = agency->getTransactionManager().getTransactionsByProperty(propertyId);
-    return std::ranges::any_of(existingTransactions,
-                               [&clientId, amount](const Transaction *trans)
-                               {
-                                   return trans->getClientId() == clientId && trans->getStatus() == "completed" &&
-                                          trans->getFinalPrice() == amount;
-                               });
-}
-
-std::string generateBaseTransactionId()
-{
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto tm = Utils::getLocalTime(time);
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%H%M%S");
-    std::string transactionId = oss.str();
-
-    if (transactionId.length() < 8)
-    {
-        transactionId += std::to_string(tm.tm_mday % 100);
-    }
-
-    if (transactionId.length() > 8)
-    {
-        transactionId = transactionId.substr(0, 8);
-    }
-    if (transactionId.length() < 6)
-    {
-        transactionId = transactionId + std::string(6 - transactionId.length(), '0');
-    }
+Money AuctionDialog::getStartingPrice() const { return Money::fromDouble(priceSpin->value()); }
 
-    return transactionId;
-}
-
-std::string generateFallbackTransactionId(const std::string &auctionId)
-{
-    std::string cleanId;
-    for (char c : auctionId)
-    {
-        if (std::isdigit(static_cast<unsigned char>(c)))
-            cleanId += c;
-    }
-
-    std::string transactionId;
-    if (cleanId.length() >= 6)
-    {
-        transactionId = cleanId.substr(0, 6);
-    }
-    else
-    {
-        transactionId = cleanId + std::string(6 - cleanId.length(), '0');
-    }
-
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    transactionId += std::to_string(time % 100);
-    if (transactionId.length() > 8)
-        transactionId = transactionId.substr(0, 8);
-
-    return transactionId;
-}
-
-std::string ensureUniqueTransactionId(EstateAgency *agency, const std::string &baseId, const std::string &auctionId)
-{
-    std::string transactionId = baseId;
-    std::string originalId = baseId;
-    int suffix = 1;
-
-    while (agency->getTransactionManager().findTransaction(transactionId) != nullptr)
-    {
-        if (transactionId.length() < 8)
-        {
-            transactionId = std::format("{}{}", originalId, suffix % 10);
-            if (transactionId.length() > 8)
-            {
-                transactionId = transactionId.substr(0, 8);
-            }
-        }
-        else
-        {
-            transactionId = std::format("{}{}", originalId.substr(0, 6), suffix % 100);
-        }
-        suffix++;
-
-        if (suffix > 999)
-        {
-            transactionId = generateFallbackTransactionId(auctionId);
-            suffix = 1;
-        }
-    }
-
-    return transactionId;
-}
-} 
+int AuctionDialog::getDurationHours() const { return durationSpin ? durationSpin->value() : 0; }
 
 void AuctionDialog::createTransactionFromAuction()
 {
     if (!currentAuction || !agency)
         return;
 
-    const Bid *winner = currentAuction->getHighestBid();
-    if (!winner)
-        return;
-
-    if (hasExistingTransaction(agency, currentAuction->getPropertyId(), winner->getClientId(), winner->getAmount()))
-        return;
-
-    std::string baseId = generateBaseTransactionId();
-    std::string transactionId = ensureUniqueTransactionId(agency, baseId, currentAuction->getId());
-
     try
     {
-        double finalPrice = winner->getAmount();
-        std::string notes = "Продажа через аукцион. Аукцион ID: " + currentAuction->getId();
-
-        auto transaction = std::make_shared<Transaction>(transactionId, currentAuction->getPropertyId(),
-                                                         winner->getClientId(), finalPrice, "completed", notes);
-
-        agency->getTransactionManager().addTransaction(transaction);
-
-        Property *prop = agency->getPropertyManager().findProperty(currentAuction->getPropertyId());
-        if (prop)
-        {
-            prop->setAvailable(false);
-        }
+        AuctionSettlement::settle(*currentAuction, agency->getTransactionManager(), agency->getPropertyManager());
     }
     catch (const std::invalid_argument &e)
     {
@@ -1,19 +1,28 @@
 #include "../../include/ui/AuctionsWidget.h"
 #include "../../include/core/Constants.h"
 #include "../../include/core/EstateAgency.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/entities/Auction.h"
 #include "../../include/entities/Bid.h"
 #include "../../include/entities/Property.h"
 #include "../../include/entities/Transaction.h"
 #include "../../include/ui/AuctionDialog.h"
 #include "../../include/ui/TableHelper.h"
+#include "../../include/ui/UiUtils.h"
 #include <QAbstractItemView>
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QTableWidgetItem>
+#include <ctime>
 #include <functional>
 #include <ranges>
 
+namespace
+{
+constexpr std::time_t SECONDS_PER_HOUR = 3600;
+}
+
 AuctionsWidget::AuctionsWidget(EstateAgency *agency, QWidget *parent) : QWidget(parent), agency(agency) { setupUI(); }
 
 void AuctionsWidget::setupUI()
@@ -93,6 +102,8 @@ void AuctionsWidget::refresh() { updateTable(); }
 
 void AuctionsWidget::updateTable()
 {
+    TRACE_SCOPE("AuctionsWidget::updateTable");
+    METRIC_TIME_SCOPE("ui.auctions.refresh_ns");
     if (!auctionsTable)
         return;
 
@@ -105,6 +116,9 @@ void AuctionsWidget::updateTable()
             continue;
         addAuctionToTable(auction);
     }
+
+    static Histogram &rowsRendered = MetricsRegistry::instance().histogram("ui.auctions.rows_rendered");
+    rowsRendered.record(static_cast<uint64_t>(auctionsTable->rowCount()));
 }
 
 void AuctionsWidget::addAuction()
@@ -156,7 +170,8 @@ void AuctionsWidget::addAuction()
         {
             QString id = dialog.getId();
             QString propertyId = dialog.getPropertyId();
-            double startingPrice = dialog.getStartingPrice();
+            Money startingPrice = dialog.getStartingPrice();
+            int durationHours = dialog.getDurationHours();
 
             const Property *prop = agency->getPropertyManager().findProperty(propertyId.toStdString());
             if (!prop)
@@ -167,8 +182,13 @@ void AuctionsWidget::addAuction()
 
             auto auction = std::make_shared<Auction>(id.toStdString(), propertyId.toStdString(), prop->getAddress(),
                                                      startingPrice);
+            if (durationHours > 0)
+            {
+                auction->setEndTime(std::time(nullptr) + static_cast<std::time_t>(durationHours) * SECONDS_PER_HOUR);
+            }
 
             agency->getAuctionManager().addAuction(auction);
+            agency->getAuctionScheduler().scheduleAuction(*auction);
 
             refresh();
             emit dataChanged();
@@ -216,6 +236,8 @@ void AuctionsWidget::deleteAuction()
 
     if (ret == QMessageBox::Yes)
     {
+        agency->getAuctionScheduler().unscheduleAuction(id.toStdString());
+        agency->getProxyBidding().forgetAuction(id.toStdString());
         agency->getAuctionManager().removeAuction(id.toStdString());
         refresh();
         emit dataChanged();
@@ -224,6 +246,7 @@ void AuctionsWidget::deleteAuction()
 
 void AuctionsWidget::searchAuctions()
 {
+    TRACE_SCOPE("AuctionsWidget::searchAuctions");
     if (!auctionsTable || !searchAuctionEdit)
         return;
 
@@ -286,9 +309,8 @@ void AuctionsWidget::showAuctionDetails(const Auction *auction)
     html += "<h2 style='font-weight: bold; margin-bottom: 15px;'>ДЕТАЛИ АУКЦИОНА</h2>";
 
     html += "<p><b>ID аукциона:</b> " + QString::fromStdString(auction->getId()) + "</p>";
-    html += "<p><b>Начальная цена:</b> " + QString::number(auction->getStartingPrice(), 'f', 2) + " руб.</p>";
-    html += "<p><b>Цена автоматической покупки:</b> " + QString::number(auction->getBuyoutPrice(), 'f', 2) +
-            " руб. (+70%)</p>";
+    html += "<p><b>Начальная цена:</b> " + Utils::formatPrice(auction->getStartingPrice()) + "</p>";
+    html += "<p><b>Цена автоматической покупки:</b> " + Utils::formatPrice(auction->getBuyoutPrice()) + " (+70%)</p>";
     html += "<p><b>Дата создания:</b> " + QString::fromStdString(auction->getCreatedAt()) + "</p>";
 
     QString statusText = TableHelper::getAuctionStatusText(auction->getStatus());
@@ -297,10 +319,10 @@ void AuctionsWidget::showAuctionDetails(const Auction *auction)
     if (!auction->getCompletedAt().empty())
         html += "<p><b>Дата завершения:</b> " + QString::fromStdString(auction->getCompletedAt()) + "</p>";
 
-    if (double currentBid = auction->getCurrentHighestBid(); currentBid > 0)
+    if (Money currentBid = auction->getCurrentHighestBid(); currentBid.isPositive())
     {
         const Bid *highest = auction->getHighestBid();
-        html += "<p><b>Текущая максимальная ставка:</b> " + QString::number(currentBid, 'f', 2) + " руб.</p>";
+        html += "<p><b>Текущая максимальная ставка:</b> " + Utils::formatPrice(currentBid) + "</p>";
         if (highest)
             html += "<p><b>Победитель:</b> " + QString::fromStdString(highest->getClientName()) +
                     " (ID: " + QString::fromStdString(highest->getClientId()) + ")</p>";
@@ -319,7 +341,7 @@ void AuctionsWidget::showAuctionDetails(const Auction *auction)
         html += "<p><b>ID:</b> " + QString::fromStdString(prop->getId()) + "</p>";
         html += "<p><b>Тип:</b> " + TableHelper::getPropertyTypeText(prop->getType()) + "</p>";
         html += "<p><b>Адрес:</b> " + QString::fromStdString(prop->getAddress()) + "</p>";
-        html += "<p><b>Цена:</b> " + QString::number(prop->getPrice(), 'f', 2) + " руб.</p>";
+        html += "<p><b>Цена:</b> " + Utils::formatPrice(prop->getPrice()) + "</p>";
         html += "<p><b>Площадь:</b> " + QString::number(prop->getArea(), 'f', 2) + " м²</p>";
     }
     else
@@ -337,7 +359,7 @@ void AuctionsWidget::showAuctionDetails(const Auction *auction)
             html += "<h4 style='font-weight: bold; margin-bottom: 5px;'>Ставка #" + QString::number(num) + "</h4>";
             html += "<p><b>Клиент:</b> " + QString::fromStdString(bid->getClientName()) + "</p>";
             html += "<p><b>ID клиента:</b> " + QString::fromStdString(bid->getClientId()) + "</p>";
-            html += "<p><b>Сумма:</b> " + QString::number(bid->getAmount(), 'f', 2) + " руб.</p>";
+            html += "<p><b>Сумма:</b> " + Utils::formatPrice(bid->getAmount()) + "</p>";
             html += "<p><b>Время:</b> " + QString::fromStdString(bid->getTimestamp()) + "</p>";
             html += "</div>";
             num++;
@@ -418,14 +440,14 @@ void AuctionsWidget::addAuctionToTable(const Auction *auction)
     int row = auctionsTable->rowCount();
     auctionsTable->insertRow(row);
 
-    double currentBid = auction->getCurrentHighestBid();
+    Money currentBid = auction->getCurrentHighestBid();
 
     auctionsTable->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(auction->getId())));
     auctionsTable->setItem(row, 1, new QTableWidgetItem(QString::fromStdString(auction->getPropertyAddress())));
     auctionsTable->setItem(row, 2,
-                           new QTableWidgetItem(QString::number(auction->getStartingPrice(), 'f', 2) + " руб."));
+                           new QTableWidgetItem(Utils::formatPrice(auction->getStartingPrice())));
 
-    QString currentBidText = (currentBid > 0) ? QString::number(currentBid, 'f', 2) + " руб." : "Нет ставок";
+    QString currentBidText = currentBid.isPositive() ? Utils::formatPrice(currentBid) : "Нет ставок";
     auctionsTable->setItem(row, 3, new QTableWidgetItem(currentBidText));
 
     QString statusText;
@@ -77,6 +77,8 @@ void ClientDialog::setupUI()
 void ClientDialog::loadClientData(const Client *client)
 {
     idEdit->setText(QString::fromStdString(client->getId()));
+    idEdit->setReadOnly(true);
+    idEdit->setToolTip("ID нельзя изменить: на него ссылаются сделки и поисковые профили");
     nameEdit->setText(QString::fromStdString(client->getName()));
     phoneEdit->setText(QString::fromStdString(client->getPhone()));
     emailEdit->setText(QString::fromStdString(client->getEmail()));
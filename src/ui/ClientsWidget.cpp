@@ -1,17 +1,60 @@
 #include "../../include/ui/ClientsWidget.h"
 #include "../../include/core/Constants.h"
-#include "../../include/core/Utils.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/entities/Client.h"
 #include "../../include/entities/Property.h"
 #include "../../include/entities/Transaction.h"
 #include "../../include/services/ClientManager.h"
+#include "../../include/services/ClientMatcher.h"
+#include "../../include/services/ReferentialIntegrity.h"
 #include "../../include/ui/ClientDialog.h"
 #include "../../include/ui/TableHelper.h"
+#include "../../include/ui/UiUtils.h"
 #include <QAbstractItemView>
 #include <QHeaderView>
 #include <QLabel>
 #include <QMessageBox>
+#include <QStringList>
 #include <QTableWidgetItem>
+#include <array>
+
+namespace
+{
+QString describeProfile(const SearchProfile &profile)
+{
+    QStringList parts;
+    if (profile.kind)
+    {
+        constexpr std::array KIND_TYPES = {"Apartment", "House", "Commercial"};
+        parts << TableHelper::getPropertyTypeText(KIND_TYPES[static_cast<size_t>(*profile.kind)]);
+    }
+    if (profile.city)
+    {
+        parts << QString::fromStdString(std::string(StringPool::instance().resolve(*profile.city)));
+    }
+    if (profile.minPrice || profile.maxPrice)
+    {
+        parts << "цена " + (profile.minPrice ? "от " + Utils::formatPrice(*profile.minPrice) + " " : QString()) +
+                     (profile.maxPrice ? "до " + Utils::formatPrice(*profile.maxPrice) : QString());
+    }
+    if (profile.minArea || profile.maxArea)
+    {
+        parts << "площадь " + (profile.minArea ? "от " + QString::number(*profile.minArea, 'f', 2) + " " : QString()) +
+                     (profile.maxArea ? "до " + QString::number(*profile.maxArea, 'f', 2) : QString()) + " м²";
+    }
+    if (profile.minRooms || profile.maxRooms)
+    {
+        parts << "комнат " + (profile.minRooms ? "от " + QString::number(*profile.minRooms) + " " : QString()) +
+                     (profile.maxRooms ? "до " + QString::number(*profile.maxRooms) : QString());
+    }
+    if (profile.needsParking)
+    {
+        parts << "парковка";
+    }
+    return parts.isEmpty() ? QString("любая недвижимость") : parts.join(", ");
+}
+} 
 
 ClientsWidget::ClientsWidget(EstateAgency *agency, QWidget *parent) : QWidget(parent), agency(agency) { setupUI(); }
 
@@ -90,6 +133,8 @@ void ClientsWidget::refresh() { updateTable(); }
 
 void ClientsWidget::updateTable()
 {
+    TRACE_SCOPE("ClientsWidget::updateTable");
+    METRIC_TIME_SCOPE("ui.clients.refresh_ns");
     if (!clientsTable)
     {
         return;
@@ -104,6 +149,9 @@ void ClientsWidget::updateTable()
             continue;
         addClientToTable(client);
     }
+
+    static Histogram &rowsRendered = MetricsRegistry::instance().histogram("ui.clients.rows_rendered");
+    rowsRendered.record(static_cast<uint64_t>(clientsTable->rowCount()));
 }
 
 void ClientsWidget::addClient()
@@ -116,6 +164,22 @@ void ClientsWidget::addClient()
             auto client =
                 std::make_shared<Client>(Utils::toString(dialog.getId()), Utils::toString(dialog.getName()),
                                          Utils::toString(dialog.getPhone()), Utils::toString(dialog.getEmail()));
+            if (auto duplicates = agency->getClientManager().findDuplicates(*client); !duplicates.empty())
+            {
+                const DuplicateMatch &best = duplicates.front();
+                int ret = QMessageBox::question(this, "Возможный дубликат",
+                                                QString("Похожий клиент уже есть: %1 (%2, %3), сходство %4%.\n"
+                                                        "Все равно добавить?")
+                                                    .arg(QString::fromStdString(best.client->getName()),
+                                                         QString::fromStdString(best.client->getId()),
+                                                         QString::fromStdString(best.client->getPhone()))
+                                                    .arg(qRound(best.score * 100)),
+                                                QMessageBox::Yes | QMessageBox::No);
+                if (ret != QMessageBox::Yes)
+                {
+                    return;
+                }
+            }
             agency->getClientManager().addClient(client);
             refresh();
             emit dataChanged();
@@ -184,16 +248,36 @@ void ClientsWidget::deleteClient()
     int ret = QMessageBox::question(this, Constants::Messages::CONFIRMATION,
                                     Constants::ConfirmationMessages::DELETE_CLIENT, QMessageBox::Yes | QMessageBox::No);
 
-    if (ret == QMessageBox::Yes)
+    if (ret != QMessageBox::Yes)
     {
-        agency->getClientManager().removeClient(Utils::toString(id));
-        refresh();
-        emit dataChanged();
+        return;
+    }
+
+    ReferentialIntegrity &integrity = agency->getReferentialIntegrity();
+    try
+    {
+        integrity.removeClient(Utils::toString(id));
     }
+    catch (const ReferentialIntegrityException &)
+    {
+        Dependents dependents = integrity.getClientDependents(Utils::toString(id));
+        ret = QMessageBox::question(this, Constants::Messages::CONFIRMATION,
+                                    QString("На клиента ссылаются сделки (%1).\nУдалить клиента вместе с ними?")
+                                        .arg(dependents.transactions.size()),
+                                    QMessageBox::Yes | QMessageBox::No);
+        if (ret != QMessageBox::Yes)
+        {
+            return;
+        }
+        integrity.removeClient(Utils::toString(id), DeletePolicy::Cascade);
+    }
+    refresh();
+    emit dataChanged();
 }
 
 void ClientsWidget::searchClients()
 {
+    TRACE_SCOPE("ClientsWidget::searchClients");
     if (!clientsTable || !searchClientEdit)
     {
         return;
@@ -272,6 +356,16 @@ void ClientsWidget::showClientDetails(const Client *client)
     html += "<p><b>Телефон:</b> " + QString::fromStdString(client->getPhone()) + "</p>";
     html += "<p><b>Электронная почта:</b> " + QString::fromStdString(client->getEmail()) + "</p>";
     html += "<p><b>Дата регистрации:</b> " + QString::fromStdString(client->getRegistrationDate()) + "</p>";
+
+    if (auto profiles = agency->getClientMatcher().getProfilesByClient(client->getId()); !profiles.empty())
+    {
+        html += "<h3 style='font-weight: bold; margin-top: 20px; margin-bottom: "
+                "10px;'>ПОИСКОВЫЕ ПРОФИЛИ</h3>";
+        for (const SearchProfile *profile : profiles)
+        {
+            html += "<p><b>#" + QString::number(profile->id) + ":</b> " + describeProfile(*profile) + "</p>";
+        }
+    }
     html += "</body></html>";
 
     clientDetailsText->setHtml(html);
@@ -318,7 +412,7 @@ void ClientsWidget::showClientTransactions(const std::string &clientId)
             html += "<p><b>ID сделки:</b> " + QString::fromStdString(trans->getId()) + "</p>";
             html +=
                 "<p><b>Недвижимость:</b> " + QString::fromStdString(prop ? prop->getAddress() : "Не указана") + "</p>";
-            html += "<p><b>Цена:</b> " + QString::number(trans->getFinalPrice(), 'f', 2) + " руб.</p>";
+            html += "<p><b>Цена:</b> " + Utils::formatPrice(trans->getFinalPrice()) + "</p>";
             html += "<p><b>Статус:</b> " + TableHelper::getTransactionStatusText(trans->getStatus()) + "</p>";
             html += "<p><b>Дата:</b> " + QString::fromStdString(trans->getDate()) + "</p>";
             html += "</div>";
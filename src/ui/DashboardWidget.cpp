@@ -1,8 +1,12 @@
 #include "../../include/ui/DashboardWidget.h"
 #include "../../include/core/EstateAgency.h"
 #include "../../include/entities/Property.h"
+#include "../../include/ui/UiUtils.h"
 #include <QFrame>
 #include <QHBoxLayout>
+#include <QHeaderView>
+#include <QTableWidgetItem>
+#include <algorithm>
 
 DashboardWidget::DashboardWidget(EstateAgency *agency, QWidget *parent) : QWidget(parent), agency(agency) { setupUI(); }
 
@@ -93,6 +97,23 @@ void DashboardWidget::setupUI()
     divider->setStyleSheet("background-color: #333333;");
     mainLayout->addWidget(divider);
 
+    auto *cityStatsTitle = new QLabel("Цены по городам");
+    cityStatsTitle->setStyleSheet("color: #888888; "
+                                  "font-size: 11pt; "
+                                  "font-weight: 500; "
+                                  "letter-spacing: 2px;");
+    mainLayout->addWidget(cityStatsTitle);
+
+    cityStatsTable = new QTableWidget;
+    cityStatsTable->setColumnCount(5);
+    cityStatsTable->setHorizontalHeaderLabels({"Город", "Объектов", "Средняя", "Медиана", "P90"});
+    cityStatsTable->setSelectionMode(QAbstractItemView::NoSelection);
+    cityStatsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    cityStatsTable->verticalHeader()->setVisible(false);
+    cityStatsTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    cityStatsTable->setMaximumHeight(260);
+    mainLayout->addWidget(cityStatsTable);
+
     auto *actionsWidget = new QWidget;
     auto *actionsLayout = new QVBoxLayout(actionsWidget);
     actionsLayout->setContentsMargins(0, 0, 0, 0);
@@ -173,15 +194,8 @@ void DashboardWidget::updateStats()
     int totalTransactions = agency->getTransactionManager().getCount();
     int totalAuctions = agency->getAuctionManager().getCount();
 
-    int availableProperties = 0;
-    auto properties = agency->getPropertyManager().getAllProperties();
-    for (const Property *prop : properties)
-    {
-        if (prop && prop->getIsAvailable())
-        {
-            availableProperties++;
-        }
-    }
+    auto availableProperties = std::ranges::count_if(agency->getPropertyManager().getAllProperties(),
+                                                     [](const Property *prop) { return prop->getIsAvailable(); });
 
     if (statsPropertiesLabel)
         statsPropertiesLabel->setText(QString::number(totalProperties));
@@ -193,4 +207,25 @@ void DashboardWidget::updateStats()
         statsAvailableLabel->setText(QString::number(availableProperties));
     if (statsAuctionsLabel)
         statsAuctionsLabel->setText(QString::number(totalAuctions));
+
+    updateCityStats();
+}
+
+void DashboardWidget::updateCityStats()
+{
+    if (!cityStatsTable)
+        return;
+
+    auto stats = agency->getPropertyManager().getLiveStatsByCity();
+    cityStatsTable->setRowCount(static_cast<int>(stats.size()));
+    int row = 0;
+    for (const auto &[city, cityStats] : stats)
+    {
+        cityStatsTable->setItem(row, 0, new QTableWidgetItem(Utils::toQString(city)));
+        cityStatsTable->setItem(row, 1, new QTableWidgetItem(QString::number(cityStats.count)));
+        cityStatsTable->setItem(row, 2, new QTableWidgetItem(Utils::formatNumber(cityStats.getAverage())));
+        cityStatsTable->setItem(row, 3, new QTableWidgetItem(Utils::formatNumber(cityStats.getMedian())));
+        cityStatsTable->setItem(row, 4, new QTableWidgetItem(Utils::formatNumber(cityStats.getPercentile(0.9))));
+        ++row;
+    }
 }
@@ -0,0 +1,363 @@
+#include "../../include/ui/DiagnosticsWidget.h"
+#include "../../include/core/Constants.h"
+#include "../../include/core/Metrics.h"
+#include <QAbstractItemView>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QMessageBox>
+#include <QTableWidgetItem>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+constexpr int REFRESH_INTERVAL_MS = 1000;
+constexpr double MILLISECONDS_PER_SECOND = 1000.0;
+constexpr double NANOSECONDS_PER_MICROSECOND = 1e3;
+constexpr double NANOSECONDS_PER_MILLISECOND = 1e6;
+constexpr double NANOSECONDS_PER_SECOND = 1e9;
+constexpr double PERCENT = 100.0;
+constexpr double BYTES_PER_KILOBYTE = 1024.0;
+constexpr int MEMORY_TABLE_HEIGHT = 240;
+constexpr std::string_view DURATION_SUFFIX = "_ns";
+constexpr std::string_view HITS_SUFFIX = ".lookup.hits";
+constexpr std::string_view MISSES_SUFFIX = ".lookup.misses";
+
+enum Column
+{
+    COLUMN_NAME,
+    COLUMN_TYPE,
+    COLUMN_VALUE,
+    COLUMN_RATE,
+    COLUMN_P50,
+    COLUMN_P99,
+    COLUMN_P999,
+    COLUMN_MAX,
+    COLUMN_COUNT
+};
+
+enum MemoryColumn
+{
+    MEMORY_COLUMN_NAME,
+    MEMORY_COLUMN_OBJECTS,
+    MEMORY_COLUMN_OBJECT_BYTES,
+    MEMORY_COLUMN_STRING_BYTES,
+    MEMORY_COLUMN_INDEX_BYTES,
+    MEMORY_COLUMN_BID_BYTES,
+    MEMORY_COLUMN_TOTAL,
+    MEMORY_COLUMN_ARENA,
+    MEMORY_COLUMN_COUNT
+};
+
+QString formatBytes(size_t bytes)
+{
+    auto value = static_cast<double>(bytes);
+    if (value < BYTES_PER_KILOBYTE)
+        return QString("%1 Б").arg(bytes);
+    value /= BYTES_PER_KILOBYTE;
+    if (value < BYTES_PER_KILOBYTE)
+        return QString("%1 КБ").arg(value, 0, 'f', 1);
+    value /= BYTES_PER_KILOBYTE;
+    if (value < BYTES_PER_KILOBYTE)
+        return QString("%1 МБ").arg(value, 0, 'f', 1);
+    return QString("%1 ГБ").arg(value / BYTES_PER_KILOBYTE, 0, 'f', 2);
+}
+
+QString formatValue(std::string_view name, uint64_t value)
+{
+    if (!name.ends_with(DURATION_SUFFIX))
+    {
+        return QString::number(value);
+    }
+
+    auto nanoseconds = static_cast<double>(value);
+    if (nanoseconds < NANOSECONDS_PER_MICROSECOND)
+        return QString("%1 нс").arg(value);
+    if (nanoseconds < NANOSECONDS_PER_MILLISECOND)
+        return QString("%1 мкс").arg(nanoseconds / NANOSECONDS_PER_MICROSECOND, 0, 'f', 1);
+    if (nanoseconds < NANOSECONDS_PER_SECOND)
+        return QString("%1 мс").arg(nanoseconds / NANOSECONDS_PER_MILLISECOND, 0, 'f', 1);
+    return QString("%1 с").arg(nanoseconds / NANOSECONDS_PER_SECOND, 0, 'f', 2);
+}
+
+QString getMetricTypeText(MetricType type)
+{
+    switch (type)
+    {
+    case MetricType::Counter:
+        return "Счётчик";
+    case MetricType::Gauge:
+        return "Показатель";
+    case MetricType::Histogram:
+        return "Гистограмма";
+    }
+    return QString();
+}
+} 
+
+DiagnosticsWidget::DiagnosticsWidget(EstateAgency *agency, QWidget *parent) : QWidget(parent), agency(agency)
+{
+    setupUI();
+
+    refreshTimer = new QTimer(this);
+    connect(refreshTimer, &QTimer::timeout, this, &DiagnosticsWidget::onTimerTick);
+    refreshTimer->start(REFRESH_INTERVAL_MS);
+}
+
+void DiagnosticsWidget::setupUI()
+{
+    auto *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(20, 20, 20, 20);
+    layout->setSpacing(15);
+
+    auto *headerLayout = new QHBoxLayout;
+    auto *title = new QLabel("Диагностика");
+    title->setStyleSheet("color: #ffffff; font-size: 22pt; font-weight: bold;");
+    headerLayout->addWidget(title);
+    headerLayout->addStretch();
+
+    refreshBtn = new QPushButton("🔄 Обновить");
+    resetBtn = new QPushButton("Сбросить");
+    exportBtn = new QPushButton("Сохранить метрики...");
+    headerLayout->addWidget(refreshBtn);
+    headerLayout->addWidget(resetBtn);
+    headerLayout->addWidget(exportBtn);
+    layout->addLayout(headerLayout);
+
+    dumpPathLabel = new QLabel;
+    dumpPathLabel->setStyleSheet("color: #888888; font-size: 10pt;");
+    std::string dumpPath = MetricsRegistry::instance().getDumpPath();
+    dumpPathLabel->setText(dumpPath.empty()
+                               ? QString("Периодическая выгрузка выключена (%1)")
+                                     .arg(MetricsRegistry::ENVIRONMENT_VARIABLE)
+                               : QString("Выгрузка каждую секунду: %1").arg(QString::fromStdString(dumpPath)));
+    layout->addWidget(dumpPathLabel);
+
+    metricsTable = new QTableWidget;
+    metricsTable->setColumnCount(COLUMN_COUNT);
+    metricsTable->setHorizontalHeaderLabels(
+        {"Метрика", "Тип", "Значение", "В секунду", "p50", "p99", "p99.9", "Максимум"});
+    metricsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    metricsTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    metricsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    metricsTable->setAlternatingRowColors(true);
+    metricsTable->setColumnWidth(COLUMN_NAME, 320);
+    metricsTable->setColumnWidth(COLUMN_TYPE, 120);
+    metricsTable->horizontalHeader()->setStretchLastSection(true);
+    metricsTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+    metricsTable->setShowGrid(true);
+    layout->addWidget(metricsTable, 1);
+
+    auto *memoryTitle = new QLabel("Память");
+    memoryTitle->setStyleSheet("color: #ffffff; font-size: 14pt; font-weight: bold;");
+    layout->addWidget(memoryTitle);
+
+    memoryTable = new QTableWidget;
+    memoryTable->setColumnCount(MEMORY_COLUMN_COUNT);
+    memoryTable->setHorizontalHeaderLabels(
+        {"Менеджер", "Объектов", "Объекты", "Строки", "Индексы", "Ставки", "Итого", "Арена"});
+    memoryTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    memoryTable->setSelectionMode(QAbstractItemView::NoSelection);
+    memoryTable->setAlternatingRowColors(true);
+    memoryTable->setColumnWidth(MEMORY_COLUMN_NAME, 200);
+    memoryTable->horizontalHeader()->setStretchLastSection(true);
+    memoryTable->setFixedHeight(MEMORY_TABLE_HEIGHT);
+    layout->addWidget(memoryTable);
+
+    heapLabel = new QLabel;
+    heapLabel->setStyleSheet("color: #888888; font-size: 10pt;");
+    layout->addWidget(heapLabel);
+
+    connect(refreshBtn, &QPushButton::clicked, this, &DiagnosticsWidget::refresh);
+    connect(resetBtn, &QPushButton::clicked, this, &DiagnosticsWidget::resetMetrics);
+    connect(exportBtn, &QPushButton::clicked, this, &DiagnosticsWidget::exportMetrics);
+}
+
+void DiagnosticsWidget::refresh()
+{
+    if (!metricsTable)
+        return;
+
+    if (agency)
+        agency->publishMetrics();
+
+    double elapsedSeconds = 0.0;
+    if (sinceLastRefresh.isValid())
+        elapsedSeconds = static_cast<double>(sinceLastRefresh.restart()) / MILLISECONDS_PER_SECOND;
+    else
+        sinceLastRefresh.start();
+
+    std::map<std::string, int64_t, std::less<>> hits;
+    std::map<std::string, int64_t, std::less<>> misses;
+
+    metricsTable->setRowCount(0);
+    for (const auto &metric : MetricsRegistry::instance().snapshot())
+    {
+        addMetricRow(metric, elapsedSeconds);
+
+        std::string_view name = metric.name;
+        if (name.ends_with(HITS_SUFFIX))
+            hits[std::string(name.substr(0, name.size() - HITS_SUFFIX.size()))] = metric.value;
+        else if (name.ends_with(MISSES_SUFFIX))
+            misses[std::string(name.substr(0, name.size() - MISSES_SUFFIX.size()))] = metric.value;
+    }
+
+    for (const auto &[prefix, hitCount] : hits)
+    {
+        auto it = misses.find(prefix);
+        addHitRateRow(prefix + ".lookup.hit_rate", hitCount, it != misses.end() ? it->second : 0);
+    }
+
+    updateMemoryTable();
+}
+
+void DiagnosticsWidget::updateMemoryTable()
+{
+    if (!agency || !memoryTable)
+        return;
+
+    MemoryReport report = agency->getMemoryReport();
+    MemoryUsage total = report.getTotal();
+
+    memoryTable->setRowCount(0);
+    addMemoryRow("Недвижимость", report.properties);
+    addMemoryRow("Клиенты", report.clients);
+    addMemoryRow("Сделки", report.transactions);
+    addMemoryRow("Аукционы", report.auctions);
+    addMemoryRow("Пул строк", report.symbols);
+    addMemoryRow("Всего", total);
+
+    if (!report.heapTracked)
+    {
+        heapLabel->setText("Учёт кучи выключен: соберите с -DESTATE_TRACK_ALLOCATIONS=ON для точных данных аллокатора");
+        return;
+    }
+
+    double accounted = report.heap.liveBytes > 0 ? PERCENT * static_cast<double>(total.getTotalBytes()) /
+                                                       static_cast<double>(report.heap.liveBytes)
+                                                 : 0.0;
+    heapLabel->setText(QString("Куча: %1 в %2 блоках, пик %3; менеджерами учтено %4%")
+                           .arg(formatBytes(report.heap.liveBytes))
+                           .arg(report.heap.liveAllocations)
+                           .arg(formatBytes(report.heap.peakBytes))
+                           .arg(accounted, 0, 'f', 1));
+}
+
+void DiagnosticsWidget::addMemoryRow(const QString &title, const MemoryUsage &usage)
+{
+    int row = memoryTable->rowCount();
+    memoryTable->insertRow(row);
+
+    QString objects = QString::number(usage.objectCount);
+    if (usage.bidCount > 0)
+        objects += QString(" (+%1 ставок)").arg(usage.bidCount);
+
+    memoryTable->setItem(row, MEMORY_COLUMN_NAME, new QTableWidgetItem(title));
+    memoryTable->setItem(row, MEMORY_COLUMN_OBJECTS, new QTableWidgetItem(objects));
+    memoryTable->setItem(row, MEMORY_COLUMN_OBJECT_BYTES, new QTableWidgetItem(formatBytes(usage.objectBytes)));
+    memoryTable->setItem(row, MEMORY_COLUMN_STRING_BYTES, new QTableWidgetItem(formatBytes(usage.stringBytes)));
+    memoryTable->setItem(row, MEMORY_COLUMN_INDEX_BYTES, new QTableWidgetItem(formatBytes(usage.indexBytes)));
+    memoryTable->setItem(row, MEMORY_COLUMN_BID_BYTES, new QTableWidgetItem(formatBytes(usage.bidBytes)));
+    memoryTable->setItem(row, MEMORY_COLUMN_TOTAL, new QTableWidgetItem(formatBytes(usage.getTotalBytes())));
+    memoryTable->setItem(row, MEMORY_COLUMN_ARENA, new QTableWidgetItem(formatBytes(usage.arenaBytes)));
+}
+
+void DiagnosticsWidget::addMetricRow(const MetricSnapshot &metric, double elapsedSeconds)
+{
+    int row = metricsTable->rowCount();
+    metricsTable->insertRow(row);
+
+    auto total = metric.type == MetricType::Histogram ? metric.count : static_cast<uint64_t>(metric.value);
+    QString rateText = "—";
+    if (metric.type != MetricType::Gauge)
+    {
+        auto previous = previousTotals.find(metric.name);
+        if (previous != previousTotals.end() && elapsedSeconds > 0.0 && total >= previous->second)
+            rateText = QString::number(static_cast<double>(total - previous->second) / elapsedSeconds, 'f', 1);
+        previousTotals[metric.name] = total;
+    }
+
+    metricsTable->setItem(row, COLUMN_NAME, new QTableWidgetItem(QString::fromStdString(metric.name)));
+    metricsTable->setItem(row, COLUMN_TYPE, new QTableWidgetItem(getMetricTypeText(metric.type)));
+    metricsTable->setItem(row, COLUMN_RATE, new QTableWidgetItem(rateText));
+
+    if (metric.type == MetricType::Histogram)
+    {
+        metricsTable->setItem(row, COLUMN_VALUE, new QTableWidgetItem(QString::number(metric.count)));
+        metricsTable->setItem(row, COLUMN_P50, new QTableWidgetItem(formatValue(metric.name, metric.p50)));
+        metricsTable->setItem(row, COLUMN_P99, new QTableWidgetItem(formatValue(metric.name, metric.p99)));
+        metricsTable->setItem(row, COLUMN_P999, new QTableWidgetItem(formatValue(metric.name, metric.p999)));
+        metricsTable->setItem(row, COLUMN_MAX, new QTableWidgetItem(formatValue(metric.name, metric.max)));
+    }
+    else
+    {
+        metricsTable->setItem(row, COLUMN_VALUE, new QTableWidgetItem(QString::number(metric.value)));
+    }
+}
+
+void DiagnosticsWidget::addHitRateRow(const std::string &name, int64_t hits, int64_t misses)
+{
+    int row = metricsTable->rowCount();
+    metricsTable->insertRow(row);
+
+    int64_t lookups = hits + misses;
+    QString rateText = lookups > 0
+                           ? QString("%1%").arg(PERCENT * static_cast<double>(hits) / static_cast<double>(lookups),
+                                                0, 'f', 1)
+                           : QString("—");
+
+    metricsTable->setItem(row, COLUMN_NAME, new QTableWidgetItem(QString::fromStdString(name)));
+    metricsTable->setItem(row, COLUMN_TYPE, new QTableWidgetItem("Доля попаданий"));
+    metricsTable->setItem(row, COLUMN_VALUE, new QTableWidgetItem(rateText));
+    metricsTable->setItem(row, COLUMN_RATE, new QTableWidgetItem("—"));
+}
+
+void DiagnosticsWidget::onTimerTick()
+{
+    if (isVisible())
+    {
+        refresh();
+    }
+
+    std::string dumpPath = MetricsRegistry::instance().getDumpPath();
+    if (dumpPath.empty())
+        return;
+
+    if (agency)
+        agency->publishMetrics();
+
+    try
+    {
+        MetricsRegistry::instance().dumpToFile(dumpPath);
+    }
+    catch (const std::runtime_error &e)
+    {
+        dumpPathLabel->setText(QString("Ошибка выгрузки: %1").arg(e.what()));
+    }
+}
+
+void DiagnosticsWidget::resetMetrics()
+{
+    MetricsRegistry::instance().reset();
+    previousTotals.clear();
+    sinceLastRefresh.invalidate();
+    refresh();
+}
+
+void DiagnosticsWidget::exportMetrics()
+{
+    QString fileName =
+        QFileDialog::getSaveFileName(this, "Сохранить метрики", "metrics.prom", "Метрики (*.prom *.txt)");
+    if (fileName.isEmpty())
+        return;
+
+    try
+    {
+        MetricsRegistry::instance().dumpToFile(fileName.toStdString());
+    }
+    catch (const std::runtime_error &e)
+    {
+        QMessageBox::warning(this, Constants::Messages::ERROR, e.what());
+    }
+}
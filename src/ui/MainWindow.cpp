@@ -1,10 +1,13 @@
 #include "../../include/ui/MainWindow.h"
 #include "../../include/core/Constants.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/services/AuctionManager.h"
 #include "../../include/services/ClientManager.h"
+#include "../../include/services/ClientMatcher.h"
 #include "../../include/services/FileManager.h"
 #include "../../include/services/PropertyManager.h"
 #include "../../include/services/TransactionManager.h"
+#include <QFileDialog>
 #include <QFrame>
 #include <QLabel>
 #include <QListWidget>
@@ -15,15 +18,34 @@
 #include <QStackedWidget>
 #include <QStatusBar>
 #include <QTimer>
+#include <algorithm>
+#include <ctime>
 #include <filesystem>
 #include <stdexcept>
 
+namespace
+{
+constexpr int AUCTION_DEADLINE_CHECK_INTERVAL_MS = 1000;
+constexpr size_t MAX_DUPLICATES_SHOWN = 10;
+}
+
 MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent)
 {
     try
     {
         agency = EstateAgency::getInstance();
         agency->loadAllData();
+        agency->getClientMatcher().setMatchCallback(
+            [this](const Property &property, const std::vector<const SearchProfile *> &matches)
+            {
+                if (!matches.empty())
+                {
+                    showStatusMessage(QString("Объект %1 подходит клиентам: %2")
+                                          .arg(QString::fromStdString(property.getId()))
+                                          .arg(matches.size()),
+                                      Constants::MessageTimeout::MEDIUM);
+                }
+            });
 
         applyStyles();
         setupUI();
@@ -46,6 +68,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent)
                                    auctionsWidget->refresh();
                                updateDashboardStats();
                            });
+
+        auctionDeadlineTimer = new QTimer(this);
+        connect(auctionDeadlineTimer, &QTimer::timeout, this, &MainWindow::checkAuctionDeadlines);
+        auctionDeadlineTimer->start(AUCTION_DEADLINE_CHECK_INTERVAL_MS);
     }
     catch (const FileManagerException &e)
     {
@@ -427,6 +453,21 @@ void MainWindow::setupMenuBar()
     QMenu *viewMenu = menuBar()->addMenu("Вид");
     viewMenu->addAction("Обновить все", this, &MainWindow::refreshAllData);
 
+    QMenu *diagnosticsMenu = menuBar()->addMenu("Диагностика");
+    QAction *tracingAction = diagnosticsMenu->addAction("Трассировка");
+    tracingAction->setCheckable(true);
+    tracingAction->setChecked(Tracer::isEnabled());
+    connect(tracingAction, &QAction::toggled, this, &MainWindow::toggleTracing);
+    diagnosticsMenu->addAction("Экспорт трассировки...", this, &MainWindow::exportTrace);
+    diagnosticsMenu->addAction("Поиск дубликатов клиентов", this, &MainWindow::findDuplicateClients);
+
+    QMenu *reportsMenu = menuBar()->addMenu("Отчеты");
+    reportsMenu->addAction("Продажи...", this, &MainWindow::exportSalesReport);
+    reportsMenu->addAction("Продажи по месяцам...", this, &MainWindow::exportSalesByMonthReport);
+    reportsMenu->addAction("Продажи по годам...", this, &MainWindow::exportSalesByYearReport);
+    reportsMenu->addAction("Продажи по статусам...", this, &MainWindow::exportSalesByStatusReport);
+    reportsMenu->addAction("Итоги аукционов...", this, &MainWindow::exportAuctionOutcomesReport);
+
     showStatusMessage(Constants::Messages::READY);
 }
 
@@ -458,6 +499,7 @@ void MainWindow::setupNewUI()
     navigationList->addItem("Клиенты");
     navigationList->addItem("Сделки");
     navigationList->addItem("Аукционы");
+    navigationList->addItem("Диагностика");
     navigationList->setCurrentRow(0);
     sidebarLayout->addWidget(navigationList);
 
@@ -481,12 +523,14 @@ void MainWindow::setupNewUI()
     clientsWidget = new ClientsWidget(agency, this);
     transactionsWidget = new TransactionsWidget(agency, this);
     auctionsWidget = new AuctionsWidget(agency, this);
+    diagnosticsWidget = new DiagnosticsWidget(agency, this);
 
     contentStack->addWidget(dashboardWidget);
     contentStack->addWidget(propertiesWidget);
     contentStack->addWidget(clientsWidget);
     contentStack->addWidget(transactionsWidget);
     contentStack->addWidget(auctionsWidget);
+    contentStack->addWidget(diagnosticsWidget);
 
     mainLayout->addWidget(sidebar);
     mainLayout->addWidget(contentStack, 1);
@@ -593,10 +637,139 @@ void MainWindow::onNavigationChanged(int index)
     {
         updateDashboardStats();
     }
+    else if (contentStack && contentStack->widget(index) == diagnosticsWidget)
+    {
+        diagnosticsWidget->refresh();
+    }
 }
 
 void MainWindow::onDataChanged() { updateDashboardStats(); }
 
+void MainWindow::toggleTracing(bool enabled)
+{
+    Tracer::setEnabled(enabled);
+    showStatusMessage(enabled ? "Трассировка включена" : "Трассировка выключена", Constants::MessageTimeout::SHORT);
+}
+
+void MainWindow::exportTrace()
+{
+    QString fileName =
+        QFileDialog::getSaveFileName(this, "Экспорт трассировки", "trace.json", "Chrome trace (*.json)");
+    if (fileName.isEmpty())
+        return;
+
+    try
+    {
+        size_t exported = Tracer::exportChromeTrace(fileName.toStdString());
+        showStatusMessage(QString("Экспортировано событий: %1").arg(exported), Constants::MessageTimeout::MEDIUM);
+    }
+    catch (const std::runtime_error &e)
+    {
+        QMessageBox::warning(this, Constants::Messages::ERROR, e.what());
+    }
+}
+
+void MainWindow::exportReport(
+    const QString &defaultName,
+    const std::function<ReportSummary(const ReportGenerator &, const std::string &, ReportFormat)> &write)
+{
+    if (!agency)
+        return;
+
+    QString fileName =
+        QFileDialog::getSaveFileName(this, "Экспорт отчета", defaultName, "CSV (*.csv);;HTML (*.html *.htm)");
+    if (fileName.isEmpty())
+        return;
+
+    try
+    {
+        std::string path = fileName.toStdString();
+        ReportSummary summary =
+            write(agency->getReportGenerator(), path, ReportGenerator::formatFromFilename(path));
+        showStatusMessage(QString("Отчет сохранен, строк: %1").arg(summary.rows), Constants::MessageTimeout::MEDIUM);
+    }
+    catch (const ReportGeneratorException &e)
+    {
+        QMessageBox::warning(this, Constants::Messages::ERROR, e.what());
+    }
+}
+
+void MainWindow::exportSalesReport()
+{
+    exportReport("sales.csv", [](const ReportGenerator &reports, const std::string &path, ReportFormat format)
+                 { return reports.writeSales(path, format); });
+}
+
+void MainWindow::exportSalesByMonthReport()
+{
+    exportReport("sales_by_month.csv",
+                 [](const ReportGenerator &reports, const std::string &path, ReportFormat format)
+                 { return reports.writeSalesByPeriod(path, format, ReportPeriod::Month); });
+}
+
+void MainWindow::exportSalesByYearReport()
+{
+    exportReport("sales_by_year.csv",
+                 [](const ReportGenerator &reports, const std::string &path, ReportFormat format)
+                 { return reports.writeSalesByPeriod(path, format, ReportPeriod::Year); });
+}
+
+void MainWindow::exportSalesByStatusReport()
+{
+    exportReport("sales_by_status.csv",
+                 [](const ReportGenerator &reports, const std::string &path, ReportFormat format)
+                 { return reports.writeSalesByStatus(path, format); });
+}
+
+void MainWindow::exportAuctionOutcomesReport()
+{
+    exportReport("auction_outcomes.csv",
+                 [](const ReportGenerator &reports, const std::string &path, ReportFormat format)
+                 { return reports.writeAuctionOutcomes(path, format); });
+}
+
+void MainWindow::findDuplicateClients()
+{
+    if (!agency)
+        return;
+
+    auto pairs = agency->getClientManager().findAllDuplicates();
+    if (pairs.empty())
+    {
+        QMessageBox::information(this, "Дубликаты клиентов", "Возможные дубликаты не найдены");
+        return;
+    }
+
+    QString text = QString("Найдено пар: %1\n").arg(pairs.size());
+    for (size_t i = 0; i < std::min(pairs.size(), MAX_DUPLICATES_SHOWN); ++i)
+    {
+        const DuplicatePair &pair = pairs[i];
+        text += QString("\n%1 (%2) - %3 (%4): %5%")
+                    .arg(QString::fromStdString(pair.first->getName()), QString::fromStdString(pair.first->getId()),
+                         QString::fromStdString(pair.second->getName()), QString::fromStdString(pair.second->getId()))
+                    .arg(qRound(pair.score * 100));
+    }
+    QMessageBox::information(this, "Дубликаты клиентов", text);
+}
+
+void MainWindow::checkAuctionDeadlines()
+{
+    if (!agency)
+        return;
+
+    if (agency->getAuctionScheduler().tick(std::time(nullptr)) == 0)
+        return;
+
+    if (auctionsWidget)
+        auctionsWidget->refresh();
+    if (transactionsWidget)
+        transactionsWidget->refresh();
+    if (propertiesWidget)
+        propertiesWidget->refresh();
+    updateDashboardStats();
+    showStatusMessage(Constants::OperationMessages::AUCTIONS_EXPIRED, Constants::MessageTimeout::MEDIUM);
+}
+
 void MainWindow::saveAllData()
 {
     if (!agency)
@@ -1,6 +1,7 @@
 #include "../../include/ui/PropertiesWidget.h"
 #include "../../include/core/Constants.h"
-#include "../../include/core/Utils.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/entities/Apartment.h"
 #include "../../include/entities/Client.h"
 #include "../../include/entities/CommercialProperty.h"
@@ -8,10 +9,14 @@
 #include "../../include/entities/PropertyParams.h"
 #include "../../include/entities/Transaction.h"
 #include "../../include/services/ClientManager.h"
+#include "../../include/services/ClientMatcher.h"
 #include "../../include/services/PropertyManager.h"
+#include "../../include/services/PropertyQuery.h"
+#include "../../include/services/ReferentialIntegrity.h"
 #include "../../include/services/TransactionManager.h"
 #include "../../include/ui/PropertyDialog.h"
 #include "../../include/ui/TableHelper.h"
+#include "../../include/ui/UiUtils.h"
 #include <QAbstractItemView>
 #include <QBrush>
 #include <QColor>
@@ -19,8 +24,20 @@
 #include <QLabel>
 #include <QMessageBox>
 #include <QTableWidgetItem>
+#include <algorithm>
 #include <ranges>
 
+namespace
+{
+constexpr int FILTER_PRICE_MAX_RUBLES = 1000000000;
+constexpr int FILTER_PRICE_STEP_RUBLES = 100000;
+constexpr int FILTER_ROOMS_MAX = 20;
+constexpr int SORT_PRICE_ASC = 1;
+constexpr int SORT_PRICE_DESC = 2;
+constexpr int SORT_AREA_DESC = 3;
+constexpr size_t MAX_MATCHES_SHOWN = 20;
+} 
+
 PropertiesWidget::PropertiesWidget(EstateAgency *agency, QWidget *parent) : QWidget(parent), agency(agency)
 {
     setupUI();
@@ -54,6 +71,38 @@ void PropertiesWidget::setupUI()
     headerLayout->addWidget(helpBtn);
     layout->addLayout(headerLayout);
 
+    auto *filterLayout = new QHBoxLayout;
+    filterTypeCombo = new QComboBox;
+    filterTypeCombo->addItems({"Все типы", "Квартиры", "Дома", "Коммерческая"});
+    minPriceSpin = new QSpinBox;
+    maxPriceSpin = new QSpinBox;
+    for (QSpinBox *spin : {minPriceSpin, maxPriceSpin})
+    {
+        spin->setRange(0, FILTER_PRICE_MAX_RUBLES);
+        spin->setSingleStep(FILTER_PRICE_STEP_RUBLES);
+        spin->setSuffix(" руб.");
+        spin->setSpecialValueText("не задано");
+    }
+    minRoomsSpin = new QSpinBox;
+    minRoomsSpin->setRange(0, FILTER_ROOMS_MAX);
+    minRoomsSpin->setSpecialValueText("любое");
+    availableOnlyCheck = new QCheckBox("Только доступные");
+    sortCombo = new QComboBox;
+    sortCombo->addItems({"Без сортировки", "Цена ↑", "Цена ↓", "Площадь ↓"});
+    applyFilterBtn = new QPushButton("Применить фильтр");
+    filterLayout->addWidget(filterTypeCombo);
+    filterLayout->addWidget(new QLabel("Цена от"));
+    filterLayout->addWidget(minPriceSpin);
+    filterLayout->addWidget(new QLabel("до"));
+    filterLayout->addWidget(maxPriceSpin);
+    filterLayout->addWidget(new QLabel("Комнат от"));
+    filterLayout->addWidget(minRoomsSpin);
+    filterLayout->addWidget(availableOnlyCheck);
+    filterLayout->addWidget(sortCombo);
+    filterLayout->addStretch();
+    filterLayout->addWidget(applyFilterBtn);
+    layout->addLayout(filterLayout);
+
     auto *splitter = new QSplitter(Qt::Horizontal);
 
     propertiesTable = new QTableWidget;
@@ -97,6 +146,7 @@ void PropertiesWidget::setupUI()
     connect(addPropertyBtn, &QPushButton::clicked, this, &PropertiesWidget::addProperty);
     connect(refreshPropertyBtn, &QPushButton::clicked, this, &PropertiesWidget::refresh);
     connect(searchPropertyBtn, &QPushButton::clicked, this, &PropertiesWidget::searchProperties);
+    connect(applyFilterBtn, &QPushButton::clicked, this, &PropertiesWidget::applyFilters);
     connect(helpBtn, &QPushButton::clicked, this, &PropertiesWidget::showHelp);
     connect(propertiesTable, &QTableWidget::itemSelectionChanged, this, &PropertiesWidget::propertySelectionChanged);
 }
@@ -105,6 +155,8 @@ void PropertiesWidget::refresh() { updateTable(); }
 
 void PropertiesWidget::updateTable()
 {
+    TRACE_SCOPE("PropertiesWidget::updateTable");
+    METRIC_TIME_SCOPE("ui.properties.refresh_ns");
     if (!propertiesTable)
     {
         return;
@@ -119,6 +171,9 @@ void PropertiesWidget::updateTable()
             continue;
         addPropertyToTable(prop);
     }
+
+    static Histogram &rowsRendered = MetricsRegistry::instance().histogram("ui.properties.rows_rendered");
+    rowsRendered.record(static_cast<uint64_t>(propertiesTable->rowCount()));
 }
 
 void PropertiesWidget::addProperty()
@@ -132,7 +187,7 @@ void PropertiesWidget::addProperty()
             QString city = dialog.getCity();
             QString street = dialog.getStreet();
             QString house = dialog.getHouse();
-            double price = dialog.getPrice();
+            Money price = dialog.getPrice();
             double area = dialog.getArea();
             QString description = dialog.getDescription();
 
@@ -207,7 +262,7 @@ void PropertiesWidget::editProperty()
             QString city = dialog.getCity();
             QString street = dialog.getStreet();
             QString house = dialog.getHouse();
-            double price = dialog.getPrice();
+            Money price = dialog.getPrice();
             double area = dialog.getArea();
             QString description = dialog.getDescription();
 
@@ -271,16 +326,38 @@ void PropertiesWidget::deleteProperty()
         QMessageBox::question(this, Constants::Messages::CONFIRMATION, Constants::ConfirmationMessages::DELETE_PROPERTY,
                               QMessageBox::Yes | QMessageBox::No);
 
-    if (ret == QMessageBox::Yes)
+    if (ret != QMessageBox::Yes)
     {
-        agency->getPropertyManager().removeProperty(Utils::toString(id));
-        refresh();
-        emit dataChanged();
+        return;
+    }
+
+    ReferentialIntegrity &integrity = agency->getReferentialIntegrity();
+    try
+    {
+        integrity.removeProperty(Utils::toString(id));
     }
+    catch (const ReferentialIntegrityException &)
+    {
+        Dependents dependents = integrity.getPropertyDependents(Utils::toString(id));
+        ret = QMessageBox::question(this, Constants::Messages::CONFIRMATION,
+                                    QString("На объект ссылаются сделки (%1) и аукционы (%2).\n"
+                                            "Удалить объект вместе с ними?")
+                                        .arg(dependents.transactions.size())
+                                        .arg(dependents.auctions.size()),
+                                    QMessageBox::Yes | QMessageBox::No);
+        if (ret != QMessageBox::Yes)
+        {
+            return;
+        }
+        integrity.removeProperty(Utils::toString(id), DeletePolicy::Cascade);
+    }
+    refresh();
+    emit dataChanged();
 }
 
 void PropertiesWidget::searchProperties()
 {
+    TRACE_SCOPE("PropertiesWidget::searchProperties");
     if (!propertiesTable || !searchPropertyEdit)
     {
         return;
@@ -327,6 +404,57 @@ void PropertiesWidget::searchProperties()
     }
 }
 
+void PropertiesWidget::applyFilters()
+{
+    TRACE_SCOPE("PropertiesWidget::applyFilters");
+    if (!propertiesTable)
+    {
+        return;
+    }
+
+    PropertyQuery query;
+    if (int type = filterTypeCombo->currentIndex(); type > 0)
+    {
+        query.where(PropertyField::Kind, QueryOp::Equal, static_cast<PropertyKind>(type - 1));
+    }
+    if (minPriceSpin->value() > 0)
+    {
+        query.where(PropertyField::Price, QueryOp::GreaterEqual, Money::fromRubles(minPriceSpin->value()));
+    }
+    if (maxPriceSpin->value() > 0)
+    {
+        query.where(PropertyField::Price, QueryOp::LessEqual, Money::fromRubles(maxPriceSpin->value()));
+    }
+    if (minRoomsSpin->value() > 0)
+    {
+        query.where(PropertyField::Rooms, QueryOp::GreaterEqual, static_cast<double>(minRoomsSpin->value()));
+    }
+    if (availableOnlyCheck->isChecked())
+    {
+        query.where(PropertyField::Available, QueryOp::Equal, true);
+    }
+    switch (sortCombo->currentIndex())
+    {
+    case SORT_PRICE_ASC:
+        query.orderBy(PropertyField::Price);
+        break;
+    case SORT_PRICE_DESC:
+        query.orderBy(PropertyField::Price, true);
+        break;
+    case SORT_AREA_DESC:
+        query.orderBy(PropertyField::Area, true);
+        break;
+    default:
+        break;
+    }
+
+    TableHelper::clearTable(propertiesTable);
+    for (const Property *prop : agency->getPropertyManager().query(query))
+    {
+        addPropertyToTable(prop);
+    }
+}
+
 void PropertiesWidget::propertySelectionChanged()
 {
     if (!propertiesTable)
@@ -366,7 +494,7 @@ void PropertiesWidget::showPropertyDetails(const Property *prop)
     html += "<p><b>Улица:</b> " + QString::fromStdString(prop->getStreet()) + "</p>";
     html += "<p><b>Дом:</b> " + QString::fromStdString(prop->getHouse()) + "</p>";
     html += "<p><b>Адрес:</b> " + QString::fromStdString(prop->getAddress()) + "</p>";
-    html += "<p><b>Цена:</b> " + QString::number(prop->getPrice(), 'f', 2) + " руб.</p>";
+    html += "<p><b>Цена:</b> " + Utils::formatPrice(prop->getPrice()) + "</p>";
     html += "<p><b>Площадь:</b> " + QString::number(prop->getArea(), 'f', 2) + " м²</p>";
     html += "<p><b>Доступность:</b> " + QString(prop->getIsAvailable() ? "Доступна" : "Недоступна") + "</p>";
     if (!prop->getDescription().empty())
@@ -400,6 +528,32 @@ void PropertiesWidget::showPropertyDetails(const Property *prop)
         html += "<p><b>Видимость с улицы:</b> " + QString(comm->getIsVisibleFromStreet() ? "Да" : "Нет") + "</p>";
     }
 
+    if (auto history = agency->getPropertyManager().getPriceHistory().getHistory(prop->getId()); history.size() > 1)
+    {
+        html += "<h3 style='font-weight: bold; margin-top: 20px; margin-bottom: "
+                "10px;'>ИСТОРИЯ ЦЕН</h3>";
+        for (const auto &point : history)
+        {
+            QString time = point.time == PriceHistory::UNKNOWN_TIME
+                               ? QString("—")
+                               : QString::fromStdString(Utils::formatTime(point.time));
+            html += "<p><b>" + time + ":</b> " + Utils::formatPrice(point.price) + "</p>";
+        }
+    }
+
+    if (auto matches = agency->getClientMatcher().match(*prop); !matches.empty())
+    {
+        html += "<h3 style='font-weight: bold; margin-top: 20px; margin-bottom: "
+                "10px;'>ПОДХОДЯЩИЕ КЛИЕНТЫ (" +
+                QString::number(matches.size()) + ")</h3>";
+        for (size_t i = 0; i < std::min(matches.size(), MAX_MATCHES_SHOWN); ++i)
+        {
+            const Client *client = agency->getClientManager().findClient(matches[i]->clientId);
+            html += "<p>" + QString::fromStdString(matches[i]->clientId) +
+                    (client ? " - " + QString::fromStdString(client->getName()) : QString()) + "</p>";
+        }
+    }
+
     html += "</body></html>";
     propertyDetailsText->setHtml(html);
 }
@@ -444,7 +598,7 @@ void PropertiesWidget::showPropertyTransactions(const std::string &propertyId)
             html += "<h4 style='font-weight: bold; margin-bottom: 5px;'>Сделка #" + QString::number(num) + "</h4>";
             html += "<p><b>ID сделки:</b> " + QString::fromStdString(trans->getId()) + "</p>";
             html += "<p><b>Клиент:</b> " + QString::fromStdString(client ? client->getName() : "Не указан") + "</p>";
-            html += "<p><b>Цена:</b> " + QString::number(trans->getFinalPrice(), 'f', 2) + " руб.</p>";
+            html += "<p><b>Цена:</b> " + Utils::formatPrice(trans->getFinalPrice()) + "</p>";
             html += "<p><b>Статус:</b> " + TableHelper::getTransactionStatusText(trans->getStatus()) + "</p>";
             html += "<p><b>Дата:</b> " + QString::fromStdString(trans->getDate()) + "</p>";
             html += "</div>";
@@ -196,10 +196,12 @@ void PropertyDialog::propertyTypeChanged(int index)
 void PropertyDialog::loadPropertyData(const Property *prop)
 {
     common.idEdit->setText(QString::fromStdString(prop->getId()));
+    common.idEdit->setReadOnly(true);
+    common.idEdit->setToolTip("ID нельзя изменить: на него ссылаются сделки и аукционы");
     common.cityEdit->setText(QString::fromStdString(prop->getCity()));
     common.streetEdit->setText(QString::fromStdString(prop->getStreet()));
     common.houseEdit->setText(QString::fromStdString(prop->getHouse()));
-    common.priceSpin->setValue(prop->getPrice());
+    common.priceSpin->setValue(prop->getPrice().toDouble());
     common.areaSpin->setValue(prop->getArea());
     common.descriptionEdit->setPlainText(QString::fromStdString(prop->getDescription()));
     common.availableCheck->setChecked(prop->getIsAvailable());
@@ -323,7 +325,7 @@ QString PropertyDialog::getId() const { return common.idEdit->text(); }
 QString PropertyDialog::getCity() const { return common.cityEdit->text(); }
 QString PropertyDialog::getStreet() const { return common.streetEdit->text(); }
 QString PropertyDialog::getHouse() const { return common.houseEdit->text(); }
-double PropertyDialog::getPrice() const { return common.priceSpin->value(); }
+Money PropertyDialog::getPrice() const { return Money::fromDouble(common.priceSpin->value()); }
 double PropertyDialog::getArea() const { return common.areaSpin->value(); }
 QString PropertyDialog::getDescription() const { return common.descriptionEdit->toPlainText(); }
 bool PropertyDialog::getIsAvailable() const { return common.availableCheck->isChecked(); }
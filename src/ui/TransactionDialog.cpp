@@ -182,7 +182,7 @@ void TransactionDialog::loadTransactionData(const Transaction *trans)
     }
     if (clientIndex >= 0)
         clientCombo->setCurrentIndex(clientIndex);
-    priceSpin->setValue(trans->getFinalPrice());
+    priceSpin->setValue(trans->getFinalPrice().toDouble());
 
     if (trans->getStatus() == "pending")
         statusCombo->setCurrentIndex(0); 
@@ -270,7 +270,7 @@ void TransactionDialog::updatePriceFromProperty()
 
     if (prop)
     {
-        double propertyPrice = prop->getPrice();
+        double propertyPrice = prop->getPrice().toDouble();
         isUpdatingFromProperty = true;
         priceSpin->setValue(propertyPrice);
         isUpdatingFromProperty = false;
@@ -299,7 +299,7 @@ void TransactionDialog::updatePriceDifference()
 
     if (prop)
     {
-        double propertyPrice = prop->getPrice();
+        double propertyPrice = prop->getPrice().toDouble();
         double transactionPrice = priceSpin->value();
         double difference = transactionPrice - propertyPrice;
         double percentDiff = (difference / propertyPrice) * 100.0;
@@ -345,7 +345,7 @@ QString TransactionDialog::getClientId() const
     }
     return text;
 }
-double TransactionDialog::getFinalPrice() const { return priceSpin->value(); }
+Money TransactionDialog::getFinalPrice() const { return Money::fromDouble(priceSpin->value()); }
 QString TransactionDialog::getStatus() const
 {
     if (QString currentText = statusCombo->currentText(); currentText == "В ожидании")
@@ -1,12 +1,14 @@
 #include "../../include/ui/TransactionsWidget.h"
 #include "../../include/core/Constants.h"
-#include "../../include/core/Utils.h"
+#include "../../include/core/Metrics.h"
+#include "../../include/core/Tracing.h"
 #include "../../include/entities/Client.h"
 #include "../../include/entities/Property.h"
 #include "../../include/entities/Transaction.h"
 #include "../../include/services/TransactionManager.h"
 #include "../../include/ui/TableHelper.h"
 #include "../../include/ui/TransactionDialog.h"
+#include "../../include/ui/UiUtils.h"
 #include <QAbstractItemView>
 #include <QHeaderView>
 #include <QMessageBox>
@@ -97,18 +99,30 @@ void TransactionsWidget::refresh() { updateTable(); }
 
 void TransactionsWidget::updateTable()
 {
+    TRACE_SCOPE("TransactionsWidget::updateTable");
+    METRIC_TIME_SCOPE("ui.transactions.refresh_ns");
     if (!transactionsTable)
         return;
 
     TableHelper::clearTable(transactionsTable);
     auto transactions = agency->getTransactionManager().getAllTransactions();
+    const auto &properties = agency->getPropertyManager().getProperties();
+    const auto &clients = agency->getClientManager().getClients();
+    auto propertyRows = agency->getPropertyManager().getIdRows();
+    auto clientRows = agency->getClientManager().getIdRows();
 
     for (const Transaction *trans : transactions)
     {
         if (!trans)
             continue;
-        addTransactionToTable(trans);
+        auto prop = propertyRows->find(trans->getPropertyId());
+        auto client = clientRows->find(trans->getClientId());
+        addTransactionToTable(trans, prop != propertyRows->end() ? properties[prop->second].get() : nullptr,
+                              client != clientRows->end() ? clients[client->second].get() : nullptr);
     }
+
+    static Histogram &rowsRendered = MetricsRegistry::instance().histogram("ui.transactions.rows_rendered");
+    rowsRendered.record(static_cast<uint64_t>(transactionsTable->rowCount()));
 }
 
 void TransactionsWidget::addTransaction()
@@ -154,7 +168,7 @@ void TransactionsWidget::addTransaction()
             if (Property *prop = agency->getPropertyManager().findProperty(propertyId);
                 prop &&
                 (status == Constants::TransactionStatus::PENDING || status == Constants::TransactionStatus::COMPLETED))
-                prop->setAvailable(false);
+                agency->getPropertyManager().setAvailable(prop, false);
 
             refresh();
             emit dataChanged();
@@ -218,10 +232,10 @@ void TransactionsWidget::editTransaction()
             agency->getTransactionManager().addTransaction(newTrans);
 
             if (Property *prop = agency->getPropertyManager().findProperty(propertyId); prop)
-                prop->setAvailable(status == "cancelled");
+                agency->getPropertyManager().setAvailable(prop, status == "cancelled");
 
             if (oldProp && oldPropertyId != propertyId && !hasActiveTransactions(oldPropertyId))
-                oldProp->setAvailable(true);
+                agency->getPropertyManager().setAvailable(oldProp, true);
 
             refresh();
             emit dataChanged();
@@ -256,7 +270,7 @@ void TransactionsWidget::deleteTransaction()
         {
             Property *prop = agency->getPropertyManager().findProperty(propertyId);
             if (prop && !hasActiveTransactions(propertyId))
-                prop->setAvailable(true);
+                agency->getPropertyManager().setAvailable(prop, true);
         }
 
         refresh();
@@ -266,6 +280,7 @@ void TransactionsWidget::deleteTransaction()
 
 void TransactionsWidget::searchTransactions()
 {
+    TRACE_SCOPE("TransactionsWidget::searchTransactions");
     if (!transactionsTable || !searchTransactionEdit)
         return;
 
@@ -292,7 +307,8 @@ void TransactionsWidget::searchTransactions()
     {
         if (const Transaction *trans = agency->getTransactionManager().findTransaction(searchText.toStdString()); trans)
         {
-            addTransactionToTable(trans);
+            addTransactionToTable(trans, agency->getPropertyManager().findProperty(trans->getPropertyId()),
+                                  agency->getClientManager().findClient(trans->getClientId()));
         }
     }
 }
@@ -316,15 +332,12 @@ void TransactionsWidget::showTransactionDetails(const Transaction *trans)
     if (!trans)
         return;
 
-    const Property *prop = agency->getPropertyManager().findProperty(trans->getPropertyId());
-    const Client *client = agency->getClientManager().findClient(trans->getClientId());
-
     QString html;
     html += "<html><body style='font-family: Arial, sans-serif;'>";
     html += "<h2 style='font-weight: bold; margin-bottom: 15px;'>ДЕТАЛИ СДЕЛКИ</h2>";
     html += "<p><b>ID сделки:</b> " + QString::fromStdString(trans->getId()) + "</p>";
     html += "<p><b>Дата:</b> " + QString::fromStdString(trans->getDate()) + "</p>";
-    html += "<p><b>Цена:</b> " + QString::number(trans->getFinalPrice(), 'f', 2) + " руб.</p>";
+    html += "<p><b>Цена:</b> " + Utils::formatPrice(trans->getFinalPrice()) + "</p>";
     html += "<p><b>Статус:</b> " + TableHelper::getTransactionStatusText(trans->getStatus()) + "</p>";
     if (!trans->getNotes().empty())
         html += "<p><b>Примечания:</b> " + QString::fromStdString(trans->getNotes()) + "</p>";
@@ -335,7 +348,7 @@ void TransactionsWidget::showTransactionDetails(const Transaction *trans)
         html += "<p><b>ID:</b> " + QString::fromStdString(prop->getId()) + "</p>";
         html += "<p><b>Тип:</b> " + TableHelper::getPropertyTypeText(prop->getType()) + "</p>";
         html += "<p><b>Адрес:</b> " + QString::fromStdString(prop->getAddress()) + "</p>";
-        html += "<p><b>Цена:</b> " + QString::number(prop->getPrice(), 'f', 2) + " руб.</p>";
+        html += "<p><b>Цена:</b> " + Utils::formatPrice(prop->getPrice()) + "</p>";
     }
     else
         html += "<p>Недвижимость не найдена.</p>";
@@ -435,7 +448,7 @@ bool TransactionsWidget::checkTableSelection(const QTableWidget *table, const QS
     return TableHelper::checkTableSelection(table, errorMessage, this);
 }
 
-void TransactionsWidget::addTransactionToTable(const Transaction *trans)
+void TransactionsWidget::addTransactionToTable(const Transaction *trans, const Property *prop, const Client *client)
 {
     if (!trans || !transactionsTable)
         return;
@@ -0,0 +1,465 @@
+#include "../include/core/Money.h"
+#include "../include/entities/Auction.h"
+#include "../include/entities/Bid.h"
+#include "../include/services/AuctionManager.h"
+#include "../include/services/BidEngine.h"
+#include "../include/services/FileManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t DEFAULT_AUCTIONS = 1000;
+constexpr size_t DEFAULT_BIDDERS = 500;
+constexpr size_t DEFAULT_BIDS = 200000;
+constexpr double DEFAULT_RATE = 100000.0;
+constexpr size_t DEFAULT_BURST_SIZE = 64;
+constexpr double DEFAULT_ZIPF_EXPONENT = 1.1;
+constexpr uint64_t DEFAULT_SEED = 42;
+constexpr int64_t MIN_STARTING_PRICE_RUBLES = 100000;
+constexpr int64_t MAX_STARTING_PRICE_RUBLES = 50000000;
+constexpr int64_t MAX_RAISE_PER_HUNDRED_THOUSAND = 200;
+constexpr int64_t RAISE_DENOMINATOR = 100000;
+constexpr double LOWBALL_PROBABILITY = 0.05;
+constexpr int FIRST_AUCTION_ID = 10000000;
+constexpr int FIRST_BIDDER_ID = 20000000;
+constexpr double NANOSECONDS_PER_SECOND = 1e9;
+constexpr double NANOSECONDS_PER_MICROSECOND = 1e3;
+
+enum class Arrival
+{
+    Closed,
+    Poisson,
+    Burst
+};
+
+enum class Popularity
+{
+    Uniform,
+    Zipf
+};
+
+enum class Mode
+{
+    Direct,
+    Engine
+};
+
+struct Options
+{
+    size_t auctions = DEFAULT_AUCTIONS;
+    size_t bidders = DEFAULT_BIDDERS;
+    size_t bids = DEFAULT_BIDS;
+    Arrival arrival = Arrival::Closed;
+    double rate = DEFAULT_RATE;
+    size_t burstSize = DEFAULT_BURST_SIZE;
+    Popularity popularity = Popularity::Uniform;
+    double zipfExponent = DEFAULT_ZIPF_EXPONENT;
+    Mode mode = Mode::Direct;
+    size_t threads = 0;
+    uint64_t seed = DEFAULT_SEED;
+    std::string replayFile;
+    std::string recordFile;
+};
+
+struct SimEvent
+{
+    BidRequest request;
+    Auction *auction = nullptr;
+    int64_t arrivalNs = 0;
+};
+
+struct RunResult
+{
+    size_t accepted = 0;
+    size_t rejected = 0;
+    double seconds = 0.0;
+    std::vector<int64_t> latenciesNs;
+};
+
+void printUsage()
+{
+    std::cout << "Usage: auction_sim [options]\n"
+                 "  --auctions N          number of generated auctions (default 1000)\n"
+                 "  --bidders M           number of synthetic bidders (default 500)\n"
+                 "  --bids K              number of generated bids (default 200000)\n"
+                 "  --arrival MODE        closed | poisson | burst (default closed)\n"
+                 "  --rate R              mean arrival rate in bids/s for poisson and burst\n"
+                 "  --burst-size B        bids per burst (default 64)\n"
+                 "  --popularity MODE     uniform | zipf (default uniform)\n"
+                 "  --zipf-exponent S     skew of the zipf popularity (default 1.1)\n"
+                 "  --mode MODE           direct | engine (default direct)\n"
+                 "  --threads T           bid engine workers (default: hardware concurrency)\n"
+                 "  --seed S              random seed (default 42)\n"
+                 "  --replay FILE         replay the bid stream recorded in an auctions.txt\n"
+                 "  --record FILE         save the resulting auctions and bids in auctions.txt format\n";
+}
+
+Options parseOptions(int argc, char *argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            printUsage();
+            std::exit(0);
+        }
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::format("Missing value for {}", arg));
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--auctions")
+            options.auctions = std::stoull(value);
+        else if (arg == "--bidders")
+            options.bidders = std::stoull(value);
+        else if (arg == "--bids")
+            options.bids = std::stoull(value);
+        else if (arg == "--rate")
+            options.rate = std::stod(value);
+        else if (arg == "--burst-size")
+            options.burstSize = std::stoull(value);
+        else if (arg == "--zipf-exponent")
+            options.zipfExponent = std::stod(value);
+        else if (arg == "--threads")
+            options.threads = std::stoull(value);
+        else if (arg == "--seed")
+            options.seed = std::stoull(value);
+        else if (arg == "--replay")
+            options.replayFile = value;
+        else if (arg == "--record")
+            options.recordFile = value;
+        else if (arg == "--arrival")
+        {
+            if (value == "closed")
+                options.arrival = Arrival::Closed;
+            else if (value == "poisson")
+                options.arrival = Arrival::Poisson;
+            else if (value == "burst")
+                options.arrival = Arrival::Burst;
+            else
+                throw std::invalid_argument("Unknown arrival mode: " + value);
+        }
+        else if (arg == "--popularity")
+        {
+            if (value == "uniform")
+                options.popularity = Popularity::Uniform;
+            else if (value == "zipf")
+                options.popularity = Popularity::Zipf;
+            else
+                throw std::invalid_argument("Unknown popularity mode: " + value);
+        }
+        else if (arg == "--mode")
+        {
+            if (value == "direct")
+                options.mode = Mode::Direct;
+            else if (value == "engine")
+                options.mode = Mode::Engine;
+            else
+                throw std::invalid_argument("Unknown mode: " + value);
+        }
+        else
+        {
+            throw std::invalid_argument(std::format("Unknown option: {}", arg));
+        }
+    }
+
+    if (options.auctions == 0 || options.bidders == 0 || options.burstSize == 0)
+    {
+        throw std::invalid_argument("Auctions, bidders and burst size must be positive");
+    }
+    if (options.arrival != Arrival::Closed && options.rate <= 0.0)
+    {
+        throw std::invalid_argument("Arrival rate must be positive");
+    }
+    return options;
+}
+
+void assignArrivals(std::vector<SimEvent> &events, const Options &options, std::mt19937_64 &rng)
+{
+    if (options.arrival == Arrival::Closed)
+    {
+        return;
+    }
+
+    double meanGapNs = NANOSECONDS_PER_SECOND / options.rate;
+    std::exponential_distribution<double> gap(1.0 / meanGapNs);
+    double clock = 0.0;
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        if (options.arrival == Arrival::Poisson)
+        {
+            clock += gap(rng);
+        }
+        else if (i % options.burstSize == 0)
+        {
+            clock += meanGapNs * static_cast<double>(options.burstSize);
+        }
+        events[i].arrivalNs = static_cast<int64_t>(clock);
+    }
+}
+
+std::vector<SimEvent> generateEvents(AuctionManager &manager, const Options &options)
+{
+    std::mt19937_64 rng(options.seed);
+    std::uniform_int_distribution<int64_t> startPrice(MIN_STARTING_PRICE_RUBLES, MAX_STARTING_PRICE_RUBLES);
+    std::uniform_int_distribution<int64_t> raise(1, MAX_RAISE_PER_HUNDRED_THOUSAND);
+    std::uniform_int_distribution<size_t> bidderPick(0, options.bidders - 1);
+    std::bernoulli_distribution lowball(LOWBALL_PROBABILITY);
+
+    std::vector<Auction *> auctions;
+    std::vector<Money> ladder;
+    auctions.reserve(options.auctions);
+    ladder.reserve(options.auctions);
+    for (size_t i = 0; i < options.auctions; ++i)
+    {
+        std::string id = std::to_string(FIRST_AUCTION_ID + static_cast<int>(i));
+        Money price = Money::fromRubles(startPrice(rng));
+        auto auction = std::make_shared<Auction>(id, "P" + id, "Simulated lot " + id, price);
+        manager.addAuction(auction);
+        auctions.push_back(auction.get());
+        ladder.push_back(price);
+    }
+
+    std::vector<double> weights(options.auctions, 1.0);
+    if (options.popularity == Popularity::Zipf)
+    {
+        for (size_t i = 0; i < weights.size(); ++i)
+        {
+            weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), options.zipfExponent);
+        }
+    }
+    std::discrete_distribution<size_t> auctionPick(weights.begin(), weights.end());
+
+    std::vector<SimEvent> events;
+    events.reserve(options.bids);
+    for (size_t i = 0; i < options.bids; ++i)
+    {
+        size_t lot = auctionPick(rng);
+        size_t bidder = bidderPick(rng);
+        Money step = auctions[lot]->getStartingPrice().scaled(raise(rng), RAISE_DENOMINATOR);
+
+        Money amount;
+        if (lowball(rng) && ladder[lot] > step)
+        {
+            amount = ladder[lot] - step;
+        }
+        else
+        {
+            ladder[lot] += step;
+            amount = ladder[lot];
+        }
+
+        std::string bidderId = std::to_string(FIRST_BIDDER_ID + static_cast<int>(bidder));
+        events.push_back({{auctions[lot]->getId(), bidderId, "Bidder " + bidderId, amount, 0}, auctions[lot], 0});
+    }
+
+    assignArrivals(events, options, rng);
+    return events;
+}
+
+std::vector<SimEvent> loadReplay(AuctionManager &recorded, AuctionManager &target, const Options &options)
+{
+    FileManager::loadAuctions(recorded, options.replayFile);
+
+    std::vector<SimEvent> events;
+    for (const auto &source : recorded.getAuctions())
+    {
+        auto auction = std::make_shared<Auction>(source->getId(), source->getPropertyId(),
+                                                 source->getPropertyAddress(), source->getStartingPrice());
+        target.addAuction(auction);
+        for (const auto &bid : source->getBids())
+        {
+            events.push_back(
+                {{auction->getId(), bid->getClientId(), bid->getClientName(), bid->getAmount(), 0}, auction.get(), 0});
+        }
+    }
+
+    std::mt19937_64 rng(options.seed);
+    assignArrivals(events, options, rng);
+    return events;
+}
+
+void waitUntil(Clock::time_point target)
+{
+    while (Clock::now() < target)
+    {
+        std::this_thread::yield();
+    }
+}
+
+RunResult runDirect(const std::vector<SimEvent> &events, const Options &options)
+{
+    RunResult result;
+    result.latenciesNs.reserve(events.size());
+
+    auto start = Clock::now();
+    for (const auto &event : events)
+    {
+        auto origin = Clock::now();
+        if (options.arrival != Arrival::Closed)
+        {
+            origin = start + std::chrono::nanoseconds(event.arrivalNs);
+            waitUntil(origin);
+        }
+
+        const BidRequest &request = event.request;
+        bool accepted =
+            event.auction->isActive() &&
+            event.auction->addBid(std::make_shared<Bid>(request.clientId, request.clientName, request.amount));
+        auto done = Clock::now();
+
+        if (accepted)
+            ++result.accepted;
+        else
+            ++result.rejected;
+        result.latenciesNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(done - origin).count());
+    }
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return result;
+}
+
+RunResult runEngine(AuctionManager &manager, const std::vector<SimEvent> &events, const Options &options)
+{
+    RunResult result;
+    std::vector<Clock::time_point> origins(events.size());
+    std::vector<Clock::time_point> completions(events.size());
+
+    BidEngine engine(manager, options.threads);
+    engine.setResultCallback([&completions](const BidResult &bidResult)
+                             { completions[bidResult.request.sequence - 1] = Clock::now(); });
+    engine.start();
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        origins[i] = Clock::now();
+        if (options.arrival != Arrival::Closed)
+        {
+            origins[i] = start + std::chrono::nanoseconds(events[i].arrivalNs);
+            waitUntil(origins[i]);
+        }
+        engine.submit(events[i].request);
+    }
+    engine.drain();
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    engine.stop();
+
+    result.accepted = engine.getAcceptedCount();
+    result.rejected = engine.getRejectedCount();
+    result.latenciesNs.reserve(events.size());
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        result.latenciesNs.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(completions[i] - origins[i]).count());
+    }
+    return result;
+}
+
+double percentileMicros(const std::vector<int64_t> &sorted, double quantile)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    auto rank = static_cast<size_t>(std::ceil(quantile * static_cast<double>(sorted.size())));
+    size_t index = std::clamp<size_t>(rank, 1, sorted.size()) - 1;
+    return static_cast<double>(sorted[index]) / NANOSECONDS_PER_MICROSECOND;
+}
+
+size_t countReplayMismatches(const AuctionManager &recorded, const AuctionManager &replayed)
+{
+    size_t mismatches = 0;
+    for (const auto &source : recorded.getAuctions())
+    {
+        const Auction *copy = replayed.findAuction(source->getId());
+        if (!copy || copy->getCurrentHighestBid() != source->getCurrentHighestBid())
+        {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+std::string_view arrivalName(Arrival arrival)
+{
+    switch (arrival)
+    {
+    case Arrival::Poisson:
+        return "poisson";
+    case Arrival::Burst:
+        return "burst";
+    default:
+        return "closed";
+    }
+}
+
+void printReport(const Options &options, size_t auctionCount, RunResult &result)
+{
+    std::ranges::sort(result.latenciesNs);
+    size_t submitted = result.accepted + result.rejected;
+    double throughput = result.seconds > 0.0 ? static_cast<double>(submitted) / result.seconds : 0.0;
+
+    std::cout << std::format("mode: {}, arrival: {}, auctions: {}, bids: {}\n",
+                             options.mode == Mode::Engine ? "engine" : "direct", arrivalName(options.arrival),
+                             auctionCount, submitted)
+              << std::format("accepted: {}, rejected: {}\n", result.accepted, result.rejected)
+              << std::format("elapsed: {:.3f} s, throughput: {:.0f} bids/s\n", result.seconds, throughput)
+              << std::format("latency us: p50 {:.2f}, p99 {:.2f}, p999 {:.2f}, max {:.2f}\n",
+                             percentileMicros(result.latenciesNs, 0.50), percentileMicros(result.latenciesNs, 0.99),
+                             percentileMicros(result.latenciesNs, 0.999), percentileMicros(result.latenciesNs, 1.0));
+}
+} 
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        Options options = parseOptions(argc, argv);
+
+        AuctionManager recorded;
+        AuctionManager manager;
+        std::vector<SimEvent> events =
+            options.replayFile.empty() ? generateEvents(manager, options) : loadReplay(recorded, manager, options);
+
+        RunResult result =
+            options.mode == Mode::Engine ? runEngine(manager, events, options) : runDirect(events, options);
+        printReport(options, manager.getCount(), result);
+
+        if (!options.recordFile.empty())
+        {
+            FileManager::saveAuctions(manager, options.recordFile);
+        }
+
+        if (!options.replayFile.empty())
+        {
+            size_t mismatches = countReplayMismatches(recorded, manager);
+            std::cout << std::format("replay: {} of {} auctions diverge from the recording\n", mismatches,
+                                     recorded.getCount());
+            return mismatches == 0 ? 0 : 2;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "auction_sim: " << e.what() << "\n";
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,490 @@
+#include "../include/core/Constants.h"
+#include "../include/core/Money.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t DEFAULT_SEED = 42;
+constexpr size_t DEFAULT_SCALE = 10000;
+constexpr size_t AUCTIONS_PER_SCALE = 100;
+constexpr size_t DEFAULT_BIDS_PER_AUCTION = 8;
+constexpr size_t RECORDS_PER_CHUNK = 65536;
+constexpr size_t MAX_ENTITIES = 90000000;
+constexpr uint64_t FIRST_ID = 10000000;
+constexpr int64_t MIN_PRICE_RUBLES = 10000;
+constexpr int64_t MAX_PRICE_RUBLES = 1000000000;
+constexpr int FIRST_YEAR = 2022;
+constexpr int YEAR_SPAN = 4;
+constexpr int64_t BUYOUT_NUMERATOR = 17;
+constexpr int64_t BUYOUT_DENOMINATOR = 10;
+
+constexpr uint64_t PROPERTIES_STREAM = 1;
+constexpr uint64_t CLIENTS_STREAM = 2;
+constexpr uint64_t TRANSACTIONS_STREAM = 3;
+constexpr uint64_t AUCTIONS_STREAM = 4;
+constexpr uint64_t ADDRESS_STREAM = 5;
+
+struct Weighted
+{
+    std::string_view value;
+    uint32_t weight;
+};
+
+constexpr std::array CITIES = {Weighted{"Minsk", 45}, Weighted{"Gomel", 11}, Weighted{"Mogilev", 8},
+                               Weighted{"Vitebsk", 8}, Weighted{"Grodno", 8},  Weighted{"Brest", 7},
+                               Weighted{"Bobruisk", 4}, Weighted{"Baranovichi", 4}, Weighted{"Borisov", 3},
+                               Weighted{"Pinsk", 2}};
+constexpr std::array STREETS = {"Lenina",     "Sovetskaya", "Pobediteley", "Nezavisimosti", "Gagarina",
+                                "Mira",       "Pushkina",   "Kirova",      "Moskovskaya",   "Sadovaya",
+                                "Lesnaya",    "Shkolnaya",  "Molodezhnaya", "Zavodskaya",   "Oktyabrskaya"};
+constexpr std::array FIRST_NAMES = {"Aleksandr", "Dmitry", "Maksim", "Sergey", "Andrey", "Anna",  "Maria",
+                                    "Elena",     "Olga",   "Tatiana", "Ivan",  "Egor",   "Nikita", "Daria"};
+constexpr std::array LAST_NAMES = {"Ivanov",  "Petrov",   "Sidorov", "Kozlov",  "Novikov", "Morozov", "Volkov",
+                                   "Sokolov", "Lebedev",  "Kovalev", "Zaitsev", "Pavlov",  "Semenov", "Golubev"};
+constexpr std::array MOBILE_CODES = {"29", "33", "44", "25"};
+constexpr std::array EMAIL_DOMAINS = {"gmail.com", "mail.ru", "yandex.by", "tut.by", "outlook.com"};
+constexpr std::array BUSINESS_TYPES = {"Office", "Retail", "Warehouse", "Restaurant", "Workshop"};
+constexpr std::array TRANSACTION_STATUSES = {Weighted{Constants::TransactionStatus::COMPLETED, 60},
+                                             Weighted{Constants::TransactionStatus::PENDING, 30},
+                                             Weighted{Constants::TransactionStatus::CANCELLED, 10}};
+constexpr std::array AUCTION_STATUSES = {Weighted{Constants::AuctionStatus::ACTIVE, 55},
+                                         Weighted{Constants::AuctionStatus::COMPLETED, 35},
+                                         Weighted{Constants::AuctionStatus::CANCELLED, 10}};
+
+struct Options
+{
+    std::filesystem::path outputDirectory = "data";
+    size_t properties = DEFAULT_SCALE;
+    size_t clients = DEFAULT_SCALE;
+    size_t transactions = DEFAULT_SCALE;
+    size_t auctions = DEFAULT_SCALE / AUCTIONS_PER_SCALE;
+    size_t bidsPerAuction = DEFAULT_BIDS_PER_AUCTION;
+    size_t threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    uint64_t seed = DEFAULT_SEED;
+};
+
+class Random
+{
+  private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t state;
+
+    static uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+  public:
+    Random(uint64_t seed, uint64_t stream, uint64_t chunk) : state(mix(mix(mix(seed) ^ stream) ^ chunk)) {}
+
+    uint64_t next() { return mix(state += GOLDEN_GAMMA); }
+
+    uint64_t below(uint64_t bound) { return bound == 0 ? 0 : next() % bound; }
+    double unit() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+    bool chance(uint32_t percent) { return below(100) < percent; }
+
+    template <typename T, size_t N> std::string_view pick(const std::array<T, N> &items)
+    {
+        return items[below(N)];
+    }
+
+    template <size_t N> std::string_view pickWeighted(const std::array<Weighted, N> &items)
+    {
+        uint32_t total = 0;
+        for (const auto &item : items)
+            total += item.weight;
+        auto roll = static_cast<uint32_t>(below(total));
+        for (const auto &item : items)
+        {
+            if (roll < item.weight)
+                return item.value;
+            roll -= item.weight;
+        }
+        return items.back().value;
+    }
+
+    double logNormal(double median, double sigma)
+    {
+        double u1 = std::max(unit(), 1e-12);
+        double u2 = unit();
+        double normal = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * 3.141592653589793 * u2);
+        return median * std::exp(sigma * normal);
+    }
+};
+
+class LineWriter
+{
+  private:
+    std::string buffer;
+
+  public:
+    explicit LineWriter(size_t reserve) { buffer.reserve(reserve); }
+
+    LineWriter &text(std::string_view value)
+    {
+        buffer.append(value);
+        return *this;
+    }
+
+    LineWriter &field(std::string_view value)
+    {
+        buffer.append(value);
+        buffer.push_back('|');
+        return *this;
+    }
+
+    LineWriter &number(uint64_t value)
+    {
+        char digits[24];
+        auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        buffer.append(digits, end);
+        return *this;
+    }
+
+    LineWriter &decimal(double value)
+    {
+        char digits[32];
+        auto end = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 1).ptr;
+        buffer.append(digits, end);
+        return *this;
+    }
+
+    LineWriter &money(Money value)
+    {
+        char digits[Money::MAX_TEXT_LENGTH];
+        buffer.append(digits, value.formatTo(digits));
+        return *this;
+    }
+
+    LineWriter &flag(bool value)
+    {
+        buffer.push_back(value ? '1' : '0');
+        return *this;
+    }
+
+    LineWriter &bar()
+    {
+        buffer.push_back('|');
+        return *this;
+    }
+
+    LineWriter &twoDigits(uint64_t value)
+    {
+        buffer.push_back(static_cast<char>('0' + value / 10));
+        buffer.push_back(static_cast<char>('0' + value % 10));
+        return *this;
+    }
+
+    LineWriter &timestamp(Random &random)
+    {
+        number(FIRST_YEAR + random.below(YEAR_SPAN)).text("-").twoDigits(1 + random.below(12));
+        text("-").twoDigits(1 + random.below(28)).text(" ").twoDigits(random.below(24));
+        return text(":").twoDigits(random.below(60)).text(":").twoDigits(random.below(60));
+    }
+
+    LineWriter &end()
+    {
+        buffer.push_back('\n');
+        return *this;
+    }
+
+    std::string take() { return std::move(buffer); }
+};
+
+Money propertyPrice(Random &random, double median)
+{
+    auto rubles = static_cast<int64_t>(random.logNormal(median, 0.6));
+    return Money::fromRubles(std::clamp(rubles, MIN_PRICE_RUBLES, MAX_PRICE_RUBLES));
+}
+
+struct Address
+{
+    std::string_view city;
+    std::string_view street;
+    uint64_t house;
+};
+
+Address propertyAddress(uint64_t index, const Options &options)
+{
+    Random random(options.seed, ADDRESS_STREAM, index);
+    std::string_view city = random.pickWeighted(CITIES);
+    std::string_view street = random.pick(STREETS);
+    return {city, street, 1 + random.below(150)};
+}
+
+std::string generateProperties(size_t first, size_t count, const Options &options, uint64_t)
+{
+    LineWriter out(count * 128);
+    for (size_t i = first; i < first + count; ++i)
+    {
+        Random random(options.seed, PROPERTIES_STREAM, i);
+        uint64_t kind = random.below(10);
+        std::string_view type = kind < 6 ? "APARTMENT" : kind < 9 ? "HOUSE" : "COMMERCIAL";
+
+        Address address = propertyAddress(i, options);
+        out.field(type).number(FIRST_ID + i).bar();
+        out.field(address.city).field(address.street).number(address.house).bar();
+
+        double area = kind < 6 ? 30.0 + random.unit() * 120.0 : 60.0 + random.unit() * 400.0;
+        double median = kind < 6 ? 90000.0 : kind < 9 ? 150000.0 : 400000.0;
+        out.money(propertyPrice(random, median)).bar().decimal(area).bar();
+        out.field("Generated listing").flag(random.chance(80)).bar();
+
+        if (kind < 6)
+        {
+            out.number(1 + random.below(5)).bar().number(1 + random.below(25)).bar();
+            out.flag(random.chance(70)).bar().flag(random.chance(60));
+        }
+        else if (kind < 9)
+        {
+            out.number(1 + random.below(3)).bar().number(2 + random.below(10)).bar();
+            out.decimal(200.0 + random.unit() * 2000.0).bar().flag(random.chance(50)).bar().flag(random.chance(70));
+        }
+        else
+        {
+            bool parking = random.chance(60);
+            out.field(random.pick(BUSINESS_TYPES)).flag(parking).bar();
+            out.number(parking ? 1 + random.below(50) : 0).bar().flag(random.chance(50));
+        }
+        out.end();
+    }
+    return out.take();
+}
+
+std::string generateClients(size_t first, size_t count, const Options &options, uint64_t chunk)
+{
+    LineWriter out(count * 96);
+    Random random(options.seed, CLIENTS_STREAM, chunk);
+    for (size_t i = first; i < first + count; ++i)
+    {
+        std::string_view firstName = random.pick(FIRST_NAMES);
+        std::string_view lastName = random.pick(LAST_NAMES);
+        uint64_t subscriber = 1000000 + (i * 7919 + random.below(7919)) % 9000000;
+
+        out.number(FIRST_ID + i).bar().text(firstName).text(" ").field(lastName);
+        out.text("+375").text(random.pick(MOBILE_CODES)).number(subscriber).bar();
+        out.text(firstName).text(".").text(lastName).text(".").number(i).text("@").field(random.pick(EMAIL_DOMAINS));
+        out.timestamp(random).end();
+    }
+    return out.take();
+}
+
+std::string generateTransactions(size_t first, size_t count, const Options &options, uint64_t chunk)
+{
+    LineWriter out(count * 80);
+    Random random(options.seed, TRANSACTIONS_STREAM, chunk);
+    for (size_t i = first; i < first + count; ++i)
+    {
+        uint64_t property = random.below(options.properties);
+        Money price = propertyPrice(random, 120000.0);
+
+        out.number(FIRST_ID + i).bar().number(FIRST_ID + property).bar();
+        out.number(FIRST_ID + random.below(options.clients)).bar().timestamp(random).bar();
+        out.money(price).bar().field(random.pickWeighted(TRANSACTION_STATUSES));
+        out.text(random.chance(20) ? "Generated deal" : "").end();
+    }
+    return out.take();
+}
+
+std::string generateAuctions(size_t first, size_t count, const Options &options, uint64_t chunk)
+{
+    LineWriter out(count * (128 + options.bidsPerAuction * 72));
+    Random random(options.seed, AUCTIONS_STREAM, chunk);
+    for (size_t i = first; i < first + count; ++i)
+    {
+        uint64_t property = random.below(options.properties);
+        Money start = propertyPrice(random, 120000.0);
+        Money buyout = start.scaled(BUYOUT_NUMERATOR, BUYOUT_DENOMINATOR);
+        std::string_view status = random.pickWeighted(AUCTION_STATUSES);
+        bool closed = status != Constants::AuctionStatus::ACTIVE;
+
+        Address address = propertyAddress(property, options);
+        out.number(FIRST_ID + i).bar().number(FIRST_ID + property).bar();
+        out.text(address.city).text(", ").text(address.street).text(", ").number(address.house).bar();
+        out.money(start).bar().money(buyout).bar().field(status).timestamp(random).bar();
+        if (closed)
+        {
+            out.timestamp(random);
+        }
+        out.bar().end();
+
+        size_t bids = status == Constants::AuctionStatus::CANCELLED ? 0 : random.below(options.bidsPerAuction + 1);
+        Money amount = start;
+        for (size_t b = 0; b < bids; ++b)
+        {
+            Money step = start.scaled(static_cast<int64_t>(1 + random.below(40)), 1000);
+            if (amount + step >= buyout)
+                break;
+            amount += step;
+            uint64_t bidder = random.below(options.clients);
+            out.text("BID|").number(FIRST_ID + i).bar().number(FIRST_ID + bidder).bar();
+            out.text("Bidder ").number(FIRST_ID + bidder).bar().money(amount).bar().timestamp(random).end();
+        }
+    }
+    return out.take();
+}
+
+using ChunkGenerator = std::function<std::string(size_t, size_t, const Options &, uint64_t)>;
+
+size_t writeFile(const std::filesystem::path &path, size_t records, const Options &options,
+                 const ChunkGenerator &generate)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Cannot open file for writing: " + path.string());
+    }
+
+    size_t chunks = (records + RECORDS_PER_CHUNK - 1) / RECORDS_PER_CHUNK;
+    size_t bytes = 0;
+    for (size_t batchStart = 0; batchStart < chunks; batchStart += options.threads)
+    {
+        size_t batchEnd = std::min(chunks, batchStart + options.threads);
+        std::vector<std::future<std::string>> pending;
+        pending.reserve(batchEnd - batchStart);
+        for (size_t chunk = batchStart; chunk < batchEnd; ++chunk)
+        {
+            size_t first = chunk * RECORDS_PER_CHUNK;
+            size_t count = std::min(RECORDS_PER_CHUNK, records - first);
+            pending.push_back(std::async(std::launch::async, generate, first, count, std::cref(options), chunk));
+        }
+        for (auto &future : pending)
+        {
+            std::string data = future.get();
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            bytes += data.size();
+        }
+    }
+
+    if (!file)
+    {
+        throw std::runtime_error("Write failed: " + path.string());
+    }
+    return bytes;
+}
+
+size_t parseCount(std::string_view arg, const std::string &value)
+{
+    size_t count = std::stoull(value);
+    if (count > MAX_ENTITIES)
+    {
+        throw std::invalid_argument(std::format("{} exceeds the 8-digit ID space ({})", arg, MAX_ENTITIES));
+    }
+    return count;
+}
+
+Options parseOptions(int argc, char *argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            std::cout << "Usage: estate_datagen [options]\n"
+                         "  --output DIR          target directory (default data)\n"
+                         "  --scale N             N properties, clients and transactions, N/100 auctions\n"
+                         "  --properties N        number of properties\n"
+                         "  --clients N           number of clients\n"
+                         "  --transactions N      number of transactions\n"
+                         "  --auctions N          number of auctions\n"
+                         "  --bids-per-auction K  maximum bids per auction (default 8)\n"
+                         "  --threads T           generator threads (default: hardware concurrency)\n"
+                         "  --seed S              random seed (default 42)\n";
+            std::exit(0);
+        }
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::format("Missing value for {}", arg));
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--output")
+            options.outputDirectory = value;
+        else if (arg == "--scale")
+        {
+            options.properties = options.clients = options.transactions = parseCount(arg, value);
+            options.auctions = std::max<size_t>(1, options.properties / AUCTIONS_PER_SCALE);
+        }
+        else if (arg == "--properties")
+            options.properties = parseCount(arg, value);
+        else if (arg == "--clients")
+            options.clients = parseCount(arg, value);
+        else if (arg == "--transactions")
+            options.transactions = parseCount(arg, value);
+        else if (arg == "--auctions")
+            options.auctions = parseCount(arg, value);
+        else if (arg == "--bids-per-auction")
+            options.bidsPerAuction = std::stoull(value);
+        else if (arg == "--threads")
+            options.threads = std::max<size_t>(1, std::stoull(value));
+        else if (arg == "--seed")
+            options.seed = std::stoull(value);
+        else
+            throw std::invalid_argument(std::format("Unknown option: {}", arg));
+    }
+
+    if ((options.transactions > 0 || options.auctions > 0) && (options.properties == 0 || options.clients == 0))
+    {
+        throw std::invalid_argument("Transactions and auctions need at least one property and one client");
+    }
+    return options;
+}
+} 
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        Options options = parseOptions(argc, argv);
+        std::filesystem::create_directories(options.outputDirectory);
+
+        struct Target
+        {
+            const char *file;
+            size_t records;
+            ChunkGenerator generate;
+        };
+        std::array targets = {Target{"properties.txt", options.properties, generateProperties},
+                              Target{"clients.txt", options.clients, generateClients},
+                              Target{"transactions.txt", options.transactions, generateTransactions},
+                              Target{"auctions.txt", options.auctions, generateAuctions}};
+
+        auto start = std::chrono::steady_clock::now();
+        size_t totalBytes = 0;
+        for (const auto &target : targets)
+        {
+            size_t bytes = writeFile(options.outputDirectory / target.file, target.records, options, target.generate);
+            totalBytes += bytes;
+            std::cout << std::format("{:<18} {:>10} records {:>12} bytes\n", target.file, target.records, bytes);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << std::format("total {:.1f} MB in {:.2f} s ({:.0f} MB/s)\n", totalBytes / 1048576.0, seconds,
+                                 seconds > 0.0 ? totalBytes / 1048576.0 / seconds : 0.0);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "estate_datagen: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}